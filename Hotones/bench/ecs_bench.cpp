@@ -0,0 +1,364 @@
+// ---------------------------------------------------------------------------
+// ecs_bench — microbenchmarks for the header-only ECS (Registry,
+// ComponentPool), printed as JSON for tracking regressions.
+//
+//   cmake -S . -B build-release -DCMAKE_BUILD_TYPE=Release
+//   cmake --build build-release --target ecs_bench
+//   ./build/ecs_bench > ecs_bench.json          (progress goes to stderr)
+//
+// Options:
+//   --sizes=1000,100000    entity counts to run (default 1k, 100k, 1M)
+//   --filter=view          only cases whose name contains the text
+//
+// Every case is timed over several runs on a fresh world; ns_per_op is the
+// median run, ns_min the fastest. allocs_per_op counts global operator new
+// calls inside the timed region. Results are only comparable between
+// builds with the same "assertions" flag (Debug builds keep the ECS
+// asserts).
+//
+// No engine dependencies: components are local plain structs, so the
+// target builds without raylib / Lua.
+// ---------------------------------------------------------------------------
+
+#include <ECS/Registry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Hotones::ECS;
+
+// ---- Allocation counting --------------------------------------------------
+
+// Every form allocates with malloc / aligned_alloc here and releases with
+// free below. The aligned forms matter: pool storage comes from
+// std::pmr::new_delete_resource(), which always passes an alignment.
+namespace {
+    std::atomic<uint64_t> g_allocations{ 0 };
+
+    void* CountedAlloc(std::size_t size) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        if (void* p = std::malloc(size ? size : 1)) return p;
+        throw std::bad_alloc();
+    }
+
+    void* CountedAlloc(std::size_t size, std::align_val_t align) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        const auto a = static_cast<std::size_t>(align);
+        // aligned_alloc wants a size that is a multiple of the alignment.
+        const std::size_t rounded = (size ? size + a - 1 : a) & ~(a - 1);
+        if (void* p = std::aligned_alloc(a, rounded)) return p;
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(std::size_t size)   { return CountedAlloc(size); }
+void* operator new[](std::size_t size) { return CountedAlloc(size); }
+void* operator new(std::size_t size, std::align_val_t align)   { return CountedAlloc(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align) { return CountedAlloc(size, align); }
+void  operator delete(void* p) noexcept                   { std::free(p); }
+void  operator delete[](void* p) noexcept                 { std::free(p); }
+void  operator delete(void* p, std::size_t) noexcept      { std::free(p); }
+void  operator delete[](void* p, std::size_t) noexcept    { std::free(p); }
+void  operator delete(void* p, std::align_val_t) noexcept                   { std::free(p); }
+void  operator delete[](void* p, std::align_val_t) noexcept                 { std::free(p); }
+void  operator delete(void* p, std::size_t, std::align_val_t) noexcept      { std::free(p); }
+void  operator delete[](void* p, std::size_t, std::align_val_t) noexcept    { std::free(p); }
+
+namespace {
+
+// ---- Components -----------------------------------------------------------
+
+struct Position { float x = 0.0f, y = 0.0f, z = 0.0f; };
+struct Velocity { float x = 1.0f, y = 0.0f, z = 0.0f; };
+struct Health   { float current = 100.0f, max = 100.0f; };
+struct Flags    { uint32_t bits = 0; };
+
+// ---- Harness --------------------------------------------------------------
+
+using Clock = std::chrono::steady_clock;
+
+// Keeps results of benchmarked loops observable.
+volatile float g_sink = 0.0f;
+
+struct Result {
+    std::string name;
+    size_t      entities;
+    size_t      ops;          // operations per run
+    int         runs;
+    double      nsPerOp;      // median
+    double      nsMin;
+    double      allocsPerOp;
+};
+
+struct Options {
+    std::vector<size_t> sizes = { 1'000, 100'000, 1'000'000 };
+    std::string         filter;
+};
+
+// A world of n entities, optionally pre-populated by the case's setup.
+struct World {
+    Registry              reg;
+    std::vector<EntityId> ids;
+    std::vector<uint32_t> order;   // random permutation of [0, n)
+};
+
+std::unique_ptr<World> MakeWorld(size_t n, bool position, bool velocity, bool health, bool flags) {
+    auto w = std::make_unique<World>();
+    w->ids.resize(n);
+    for (auto& id : w->ids) {
+        id = w->reg.CreateEntity();
+        if (position) w->reg.AddComponent<Position>(id);
+        if (velocity) w->reg.AddComponent<Velocity>(id);
+        if (health)   w->reg.AddComponent<Health>(id);
+        if (flags)    w->reg.AddComponent<Flags>(id);
+    }
+    w->order.resize(n);
+    std::iota(w->order.begin(), w->order.end(), 0u);
+    std::shuffle(w->order.begin(), w->order.end(), std::mt19937(1234u));
+    return w;
+}
+
+// Time run(world) on fresh worlds from setup(); each run performs ops
+// operations. Small sizes get more runs so every case takes similar time.
+template<typename Setup, typename Run>
+void Measure(const Options& opt, std::vector<Result>& results,
+             const char* name, size_t n, size_t ops, Setup&& setup, Run&& run)
+{
+    if (!opt.filter.empty() && std::string(name).find(opt.filter) == std::string::npos) return;
+
+    const int runs = static_cast<int>(std::clamp<size_t>(2'000'000 / std::max<size_t>(ops, 1), 5, 500));
+    std::vector<double> samples;
+    samples.reserve(static_cast<size_t>(runs));
+    uint64_t allocs = 0;
+
+    for (int r = 0; r <= runs; ++r) {   // run 0 warms caches and the allocator
+        std::unique_ptr<World> world = setup();
+        const uint64_t a0 = g_allocations.load(std::memory_order_relaxed);
+        const auto     t0 = Clock::now();
+        run(*world);
+        const auto     t1 = Clock::now();
+        const uint64_t a1 = g_allocations.load(std::memory_order_relaxed);
+        if (r == 0) continue;
+        samples.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(ops));
+        allocs += a1 - a0;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    results.push_back({ name, n, ops, runs, samples[samples.size() / 2], samples.front(),
+                        static_cast<double>(allocs) / (static_cast<double>(ops) * runs) });
+    std::fprintf(stderr, "  %-16s %8zu  %9.2f ns/op  %6.3f allocs/op\n",
+                 name, n, results.back().nsPerOp, results.back().allocsPerOp);
+}
+
+// ---- Cases ----------------------------------------------------------------
+
+void RunSize(const Options& opt, std::vector<Result>& out, size_t n)
+{
+    auto empty   = [n] { auto w = std::make_unique<World>(); w->ids.resize(n); return w; };
+    auto onlyIds = [n] { return MakeWorld(n, false, false, false, false); };
+    auto pos     = [n] { return MakeWorld(n, true, false, false, false); };
+    auto all     = [n] { return MakeWorld(n, true, true, true, true); };
+
+    // Entity lifecycle.
+    Measure(opt, out, "create", n, n, empty, [](World& w) {
+        for (auto& id : w.ids) id = w.reg.CreateEntity();
+    });
+    Measure(opt, out, "create_batch", n, n, empty, [](World& w) {
+        w.reg.CreateEntities(w.ids);
+    });
+    Measure(opt, out, "destroy", n, n, all, [](World& w) {
+        for (const uint32_t i : w.order) w.reg.DestroyEntity(w.ids[i]);
+    });
+    Measure(opt, out, "recycle", n, n,
+        [n] {
+            auto w = MakeWorld(n, false, false, false, false);
+            for (const EntityId id : w->ids) w->reg.DestroyEntity(id);
+            return w;
+        },
+        [](World& w) {
+            for (auto& id : w.ids) id = w.reg.CreateEntity();
+        });
+    // Steady-state churn: destroy a random entity, create a replacement.
+    Measure(opt, out, "churn", n, n, pos, [](World& w) {
+        for (const uint32_t i : w.order) {
+            w.reg.DestroyEntity(w.ids[i]);
+            w.ids[i] = w.reg.CreateEntity();
+            w.reg.AddComponent<Position>(w.ids[i]);
+        }
+    });
+
+    // Components.
+    Measure(opt, out, "add", n, n, onlyIds, [](World& w) {
+        for (const EntityId id : w.ids) w.reg.AddComponent<Position>(id);
+    });
+    Measure(opt, out, "add_remove", n, 2 * n, pos, [](World& w) {
+        for (const EntityId id : w.ids) w.reg.AddComponent<Velocity>(id);
+        for (const uint32_t i : w.order) w.reg.RemoveComponent<Velocity>(w.ids[i]);
+    });
+    Measure(opt, out, "get_random", n, n, pos, [](World& w) {
+        const Registry& reg = w.reg;
+        float sum = 0.0f;
+        for (const uint32_t i : w.order) sum += reg.GetComponent<Position>(w.ids[i]).x;
+        g_sink = sum;
+    });
+
+    // Iteration (worlds are built once per run; ops = entities visited).
+    Measure(opt, out, "each", n, n, all, [](World& w) {
+        float sum = 0.0f;
+        w.reg.Each<Position>([&](EntityId, Position& p) { p.x += 1.0f; sum += p.y; });
+        g_sink = sum;
+    });
+    Measure(opt, out, "view1", n, n, all, [](World& w) {
+        float sum = 0.0f;
+        w.reg.View<Position>([&](EntityId, Position& p) { p.x += 1.0f; sum += p.y; });
+        g_sink = sum;
+    });
+    Measure(opt, out, "view2", n, n, all, [](World& w) {
+        w.reg.View<Position, const Velocity>([](EntityId, Position& p, const Velocity& v) {
+            p.x += v.x; p.y += v.y; p.z += v.z;
+        });
+    });
+    Measure(opt, out, "view3", n, n, all, [](World& w) {
+        w.reg.View<Position, const Velocity, Health>([](EntityId, Position& p, const Velocity& v, Health& h) {
+            p.x += v.x; h.current -= p.y;
+        });
+    });
+    Measure(opt, out, "view4", n, n, all, [](World& w) {
+        w.reg.View<Position, const Velocity, Health, const Flags>(
+            [](EntityId, Position& p, const Velocity& v, Health& h, const Flags& f) {
+                p.x += v.x;
+                if (f.bits == 0) h.current -= p.y;
+            });
+    });
+    // Sparse intersection: the 4-component view driven by a pool of n / 8.
+    Measure(opt, out, "view2_sparse", n, n,
+        [n] {
+            auto w = MakeWorld(n, true, false, false, false);
+            for (size_t i = 0; i < n; i += 8) w->reg.AddComponent<Velocity>(w->ids[i]);
+            return w;
+        },
+        [](World& w) {
+            w.reg.View<Position, const Velocity>([](EntityId, Position& p, const Velocity& v) { p.x += v.x; });
+        });
+
+    // Sorting. "shuffled" adds Velocity in random order, as churn leaves it:
+    // view2_shuffled walks Position forward and Velocity at random, view2_sorted
+    // runs after SortAs<Velocity, Position> has lined the pools up.
+    auto shuffled = [n] {
+        auto w = MakeWorld(n, true, false, false, false);
+        for (const uint32_t i : w->order) w->reg.AddComponent<Velocity>(w->ids[i]);
+        return w;
+    };
+    Measure(opt, out, "sort", n, n,
+        [n] {
+            auto w = MakeWorld(n, false, false, false, false);
+            for (const uint32_t i : w->order) w->reg.AddComponent<Position>(w->ids[i], Position{ static_cast<float>(i) });
+            return w;
+        },
+        [](World& w) {
+            w.reg.Sort<Position>([](const Position& a, const Position& b) { return a.x < b.x; });
+        });
+    Measure(opt, out, "sort_as", n, n, shuffled, [](World& w) {
+        w.reg.SortAs<Velocity, Position>();
+    });
+    Measure(opt, out, "view2_shuffled", n, n, shuffled, [](World& w) {
+        w.reg.View<Position, const Velocity>([](EntityId, Position& p, const Velocity& v) { p.x += v.x; });
+    });
+    Measure(opt, out, "view2_sorted", n, n,
+        [&shuffled] {
+            auto w = shuffled();
+            w->reg.SortAs<Velocity, Position>();
+            return w;
+        },
+        [](World& w) {
+            w.reg.View<Position, const Velocity>([](EntityId, Position& p, const Velocity& v) { p.x += v.x; });
+        });
+}
+
+// ---- Output ---------------------------------------------------------------
+
+const char* CompilerName() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+void PrintJson(const std::vector<Result>& results)
+{
+    std::printf("{\n");
+    std::printf("  \"suite\": \"ecs\",\n");
+    std::printf("  \"schema\": 1,\n");
+    std::printf("  \"compiler\": \"%s\",\n", CompilerName());
+#ifdef NDEBUG
+    std::printf("  \"assertions\": false,\n");
+#else
+    std::printf("  \"assertions\": true,\n");
+#endif
+    std::printf("  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        std::printf("    { \"name\": \"%s\", \"entities\": %zu, \"ops\": %zu, \"runs\": %d, "
+                    "\"ns_per_op\": %.3f, \"ns_min\": %.3f, \"allocs_per_op\": %.4f }%s\n",
+                    r.name.c_str(), r.entities, r.ops, r.runs, r.nsPerOp, r.nsMin, r.allocsPerOp,
+                    i + 1 < results.size() ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+}
+
+bool ParseArgs(int argc, char** argv, Options& opt)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--sizes=", 8) == 0) {
+            opt.sizes.clear();
+            for (const char* p = arg + 8; *p;) {
+                char* end = nullptr;
+                const unsigned long long v = std::strtoull(p, &end, 10);
+                if (end == p || v == 0) return false;
+                opt.sizes.push_back(static_cast<size_t>(v));
+                p = (*end == ',') ? end + 1 : end;
+            }
+        } else if (std::strncmp(arg, "--filter=", 9) == 0) {
+            opt.filter = arg + 9;
+        } else {
+            return false;
+        }
+    }
+    return !opt.sizes.empty();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options opt;
+    if (!ParseArgs(argc, argv, opt)) {
+        std::fprintf(stderr, "usage: ecs_bench [--sizes=1000,100000,...] [--filter=name]\n");
+        return 2;
+    }
+
+    std::vector<Result> results;
+    for (const size_t n : opt.sizes) {
+        std::fprintf(stderr, "ecs_bench: %zu entities\n", n);
+        RunSize(opt, results, n);
+    }
+    PrintJson(results);
+    return 0;
+}
@@ -0,0 +1,538 @@
+// ---------------------------------------------------------------------------
+// physics_bench — static-mesh BVH benchmarks: build time, tree shape and
+// per-query work for each BVH builder and layout on the same triangle soup,
+// printed as JSON for tracking regressions.
+//
+//   cmake -S . -B build-release -DCMAKE_BUILD_TYPE=Release
+//   cmake --build build-release --target physics_bench
+//   ./build/physics_bench > physics_bench.json  (progress goes to stderr)
+//
+// Options:
+//   --obj=level.obj        benchmark a mesh from disk instead of the
+//                          generated level (v / f records only)
+//   --rooms=24             generated level size, rooms per side
+//   --queries=100000       queries per kind
+//   --workers=0            build on a JobSystem of N workers (0: serial)
+//
+// The generated level is a grid of rooms with tessellated floors, single-quad
+// ceilings and walls, doorways, crates and pillars, plus a roof and rails
+// spanning the whole map — the long, overlapping triangles architectural
+// levels are made of. Queries are seeded, so every builder answers the same
+// rays, sweeps and spheres:
+//   ray    — hitscan from eye height, 100 units
+//   sweep  — one frame of player movement, radius 0.5
+//   resolve — player-sized sphere penetration
+//   los    — line of sight between every pair of 16 players, eye to eye,
+//            one ray at a time
+//   los4   — the same rays four to a Raycast4 packet, each player's rays
+//            grouped by direction octant as RaycastBatch orders them
+// nodes_per_query / tris_per_query count visited BVH nodes (child boxes
+// tested, for the 4-wide layout) and triangle tests; queries_per_sec is
+// rays/s for the ray kinds; mismatches counts queries whose result differs
+// from the first builder's (should be 0).
+//
+// "-wide4" rows collapse the tree to BVHLayout::Wide4 after building; their
+// build_ms includes the collapse and the tree shape is the binary tree's.
+//
+// Builds against Physics/BVH.cpp and BVH4.cpp only; raylib's headers are
+// needed for their math types, not the library.
+// ---------------------------------------------------------------------------
+
+#include <Physics/BVH.hpp>
+#include <Physics/BVH4.hpp>
+#include <ECS/JobSystem.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Hotones::Physics;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string obj;
+    int         rooms   = 24;
+    size_t      queries = 100'000;
+    unsigned    workers = 0;
+};
+
+struct Builder {
+    const char*     name;
+    BVHBuildOptions options;
+};
+
+struct QueryResult {
+    const char* kind;
+    double      nsPerQuery;
+    double      nodesPerQuery;
+    double      trisPerQuery;
+    size_t      hits;
+    size_t      mismatches;
+};
+
+struct Result {
+    std::string              builder;
+    const char*              layout;
+    double                   buildMs;       // median
+    size_t                   nodes;
+    size_t                   leaves;
+    int                      depth;
+    float                    sahCost;
+    size_t                   wideNodes;     // Wide4 only
+    size_t                   packets;       // Wide4 only
+    std::vector<QueryResult> queries;
+};
+
+// ---- Mesh -----------------------------------------------------------------
+
+Tri MakeTri(Vector3 a, Vector3 b, Vector3 c) {
+    Tri t;
+    t.a = a; t.b = b; t.c = c;
+    t.centroid = { (a.x + b.x + c.x) / 3.f, (a.y + b.y + c.y) / 3.f, (a.z + b.z + c.z) / 3.f };
+    return t;
+}
+
+void AddQuad(std::vector<Tri>& out, Vector3 a, Vector3 b, Vector3 c, Vector3 d) {
+    out.push_back(MakeTri(a, b, c));
+    out.push_back(MakeTri(a, c, d));
+}
+
+// Axis-aligned wall slab from (x0,z0) to (x1,z1), height h: two quads.
+void AddWall(std::vector<Tri>& out, float x0, float z0, float x1, float z1, float y0, float h) {
+    AddQuad(out, { x0, y0, z0 }, { x1, y0, z1 }, { x1, y0 + h, z1 }, { x0, y0 + h, z0 });
+    AddQuad(out, { x1, y0, z1 }, { x0, y0, z0 }, { x0, y0 + h, z0 }, { x1, y0 + h, z1 });
+}
+
+// Box rotated about Y by `yaw`: 12 triangles.
+void AddBox(std::vector<Tri>& out, Vector3 c, Vector3 half, float yaw) {
+    const float cs = std::cos(yaw), sn = std::sin(yaw);
+    Vector3 v[8];
+    for (int i = 0; i < 8; ++i) {
+        const float x = (i & 1 ? half.x : -half.x), y = (i & 2 ? half.y : -half.y), z = (i & 4 ? half.z : -half.z);
+        v[i] = { c.x + x * cs - z * sn, c.y + y, c.z + x * sn + z * cs };
+    }
+    AddQuad(out, v[0], v[1], v[3], v[2]);
+    AddQuad(out, v[4], v[6], v[7], v[5]);
+    AddQuad(out, v[0], v[2], v[6], v[4]);
+    AddQuad(out, v[1], v[5], v[7], v[3]);
+    AddQuad(out, v[0], v[4], v[5], v[1]);
+    AddQuad(out, v[2], v[3], v[7], v[6]);
+}
+
+// Vertical cylinder side, `sides` quads.
+void AddPillar(std::vector<Tri>& out, Vector3 base, float r, float h, int sides) {
+    for (int i = 0; i < sides; ++i) {
+        const float a0 = 6.2831853f * (float)i / (float)sides, a1 = 6.2831853f * (float)(i + 1) / (float)sides;
+        const Vector3 p0 = { base.x + r * std::cos(a0), base.y, base.z + r * std::sin(a0) };
+        const Vector3 p1 = { base.x + r * std::cos(a1), base.y, base.z + r * std::sin(a1) };
+        AddQuad(out, p0, p1, { p1.x, p1.y + h, p1.z }, { p0.x, p0.y + h, p0.z });
+    }
+}
+
+constexpr float ROOM   = 10.f;
+constexpr float HEIGHT = 3.f;
+
+std::vector<Tri> GenerateLevel(int rooms) {
+    std::vector<Tri> tris;
+    std::mt19937 rng(42u);
+    std::uniform_real_distribution<float> u01(0.f, 1.f);
+    const float size = ROOM * (float)rooms;
+
+    for (int rz = 0; rz < rooms; ++rz)
+    for (int rx = 0; rx < rooms; ++rx) {
+        const float x0 = ROOM * (float)rx, z0 = ROOM * (float)rz;
+
+        // Floor, 4x4 tiles; ceiling as one quad.
+        for (int tz = 0; tz < 4; ++tz)
+        for (int tx = 0; tx < 4; ++tx) {
+            const float ax = x0 + 2.5f * (float)tx, az = z0 + 2.5f * (float)tz;
+            AddQuad(tris, { ax, 0, az }, { ax, 0, az + 2.5f }, { ax + 2.5f, 0, az + 2.5f }, { ax + 2.5f, 0, az });
+        }
+        AddQuad(tris, { x0, HEIGHT, z0 }, { x0 + ROOM, HEIGHT, z0 }, { x0 + ROOM, HEIGHT, z0 + ROOM }, { x0, HEIGHT, z0 + ROOM });
+
+        // West and south walls with a doorway (east / north come from the
+        // neighbour, or the outer wall below).
+        AddWall(tris, x0, z0, x0, z0 + 4.f, 0.f, HEIGHT);
+        AddWall(tris, x0, z0 + 6.f, x0, z0 + ROOM, 0.f, HEIGHT);
+        AddWall(tris, x0, z0 + 4.f, x0, z0 + 6.f, 2.2f, HEIGHT - 2.2f);
+        AddWall(tris, x0, z0, x0 + 4.f, z0, 0.f, HEIGHT);
+        AddWall(tris, x0 + 6.f, z0, x0 + ROOM, z0, 0.f, HEIGHT);
+        AddWall(tris, x0 + 4.f, z0, x0 + 6.f, z0, 2.2f, HEIGHT - 2.2f);
+
+        // Crates and a pillar.
+        for (int i = 0; i < 6; ++i) {
+            const Vector3 half = { 0.3f + 0.5f * u01(rng), 0.3f + 0.4f * u01(rng), 0.3f + 0.5f * u01(rng) };
+            AddBox(tris, { x0 + 1.f + 8.f * u01(rng), half.y, z0 + 1.f + 8.f * u01(rng) }, half, 3.1415927f * u01(rng));
+        }
+        AddPillar(tris, { x0 + 2.f + 6.f * u01(rng), 0.f, z0 + 2.f + 6.f * u01(rng) }, 0.3f, HEIGHT, 12);
+    }
+
+    // Outer walls, roof and rails spanning the whole level.
+    AddWall(tris, size, 0.f, size, size, 0.f, HEIGHT);
+    AddWall(tris, 0.f, size, size, size, 0.f, HEIGHT);
+    AddQuad(tris, { 0, HEIGHT + 2.f, 0 }, { size, HEIGHT + 2.f, 0 }, { size, HEIGHT + 2.f, size }, { 0, HEIGHT + 2.f, size });
+    for (int i = 1; i < rooms; i += 3) {
+        const float z = ROOM * (float)i + 5.f;
+        AddBox(tris, { size * 0.5f, HEIGHT - 0.2f, z }, { size * 0.5f, 0.05f, 0.05f }, 0.f);
+    }
+    return tris;
+}
+
+bool LoadObj(const std::string& path, std::vector<Tri>& tris) {
+    std::ifstream in(path);
+    if (!in) return false;
+    std::vector<Vector3> verts;
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream ls(line);
+        std::string tag;
+        ls >> tag;
+        if (tag == "v") {
+            Vector3 v{};
+            ls >> v.x >> v.y >> v.z;
+            verts.push_back(v);
+        } else if (tag == "f") {
+            std::vector<int> idx;
+            std::string tok;
+            while (ls >> tok) {
+                int i = std::atoi(tok.c_str());          // "i", "i/t", "i/t/n", "i//n"
+                if (i < 0) i += (int)verts.size() + 1;
+                if (i < 1 || i > (int)verts.size()) return false;
+                idx.push_back(i - 1);
+            }
+            for (size_t k = 2; k < idx.size(); ++k)
+                tris.push_back(MakeTri(verts[idx[0]], verts[idx[k - 1]], verts[idx[k]]));
+        }
+    }
+    return !tris.empty();
+}
+
+// ---- Queries --------------------------------------------------------------
+
+struct Queries {
+    std::vector<Vector3> rayOrigin, rayDir;
+    std::vector<Vector3> sweepStart, sweepEnd;
+    std::vector<Vector3> sphere;
+    std::vector<Vector3> losOrigin, losDir;     // dir spans eye to eye: t ∈ [0, 1)
+};
+
+Queries MakeQueries(const std::vector<Tri>& tris, size_t n) {
+    Vector3 lo = {  FLT_MAX,  FLT_MAX,  FLT_MAX }, hi = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    for (const Tri& t : tris)
+        for (const Vector3& v : { t.a, t.b, t.c }) {
+            lo = { std::min(lo.x, v.x), std::min(lo.y, v.y), std::min(lo.z, v.z) };
+            hi = { std::max(hi.x, v.x), std::max(hi.y, v.y), std::max(hi.z, v.z) };
+        }
+    // Player space: the bottom few units of the mesh bounds.
+    const float eyeLo = lo.y + 0.3f, eyeHi = std::min(hi.y, lo.y + 2.5f);
+
+    std::mt19937 rng(7u);
+    std::uniform_real_distribution<float> u01(0.f, 1.f);
+    auto point = [&] {
+        return Vector3{ lo.x + (hi.x - lo.x) * u01(rng), eyeLo + (eyeHi - eyeLo) * u01(rng), lo.z + (hi.z - lo.z) * u01(rng) };
+    };
+    auto direction = [&](float maxPitch) {
+        const float yaw = 6.2831853f * u01(rng), pitch = maxPitch * (2.f * u01(rng) - 1.f);
+        return Vector3{ std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch) };
+    };
+
+    Queries q;
+    for (size_t i = 0; i < n; ++i) {
+        q.rayOrigin.push_back(point());
+        q.rayDir.push_back(direction(0.3f));
+        const Vector3 s = point(), d = direction(0.f);
+        q.sweepStart.push_back(s);
+        q.sweepEnd.push_back({ s.x + 0.2f * d.x, s.y, s.z + 0.2f * d.z });
+        q.sphere.push_back(point());
+    }
+
+    auto octant = [](Vector3 d) { return (d.x < 0.f) | (d.y < 0.f) << 1 | (d.z < 0.f) << 2; };
+    while (q.losOrigin.size() < n) {
+        Vector3 eyes[16];
+        for (Vector3& e : eyes) e = point();
+        for (const Vector3& a : eyes) {
+            std::vector<Vector3> dirs;
+            for (const Vector3& b : eyes)
+                if (&a != &b) dirs.push_back({ b.x - a.x, b.y - a.y, b.z - a.z });
+            std::stable_sort(dirs.begin(), dirs.end(),
+                             [&](Vector3 x, Vector3 y) { return octant(x) < octant(y); });
+            for (const Vector3& d : dirs) {
+                if (q.losOrigin.size() == n) break;
+                q.losOrigin.push_back(a);
+                q.losDir.push_back(d);
+            }
+        }
+    }
+    return q;
+}
+
+// Per-query answers of the first builder, to check the others against.
+struct Answers {
+    std::vector<float>   ray, sweep, los;
+    std::vector<Vector3> push;
+};
+
+bool Same(float a, float b) { return std::fabs(a - b) <= 1e-4f * std::max(1.f, std::fabs(a)); }
+
+template<typename Fn>
+QueryResult Time(const char* kind, size_t n, Fn&& fn) {
+    BVHQueryStats stats;
+    size_t hits = 0, mismatches = 0;
+    fn(stats, hits, mismatches);                     // counts + warm-up
+    const auto t0 = Clock::now();
+    BVHQueryStats discard;
+    size_t h = 0, m = 0;
+    fn(discard, h, m);
+    const auto t1 = Clock::now();
+    return { kind, std::chrono::duration<double, std::nano>(t1 - t0).count() / (double)n,
+             (double)stats.nodes / (double)n, (double)stats.tris / (double)n, hits, mismatches };
+}
+
+void Walk(const BVH& bvh, int node, int depth, size_t& leaves, int& maxDepth) {
+    maxDepth = std::max(maxDepth, depth);
+    if (bvh.nodes[node].rightChild == -1) { ++leaves; return; }
+    Walk(bvh, node + 1, depth + 1, leaves, maxDepth);
+    Walk(bvh, bvh.nodes[node].rightChild, depth + 1, leaves, maxDepth);
+}
+
+// Time the three query kinds on `bvh` (a BVH or BVH4).
+template<typename Accel>
+void RunQueries(const Accel& bvh, const Queries& q, Answers& ref, bool first, Result& r) {
+    const size_t n = q.rayOrigin.size();
+    if (first) {
+        ref.ray.assign(n, 0.f);
+        ref.sweep.assign(n, 0.f);
+        ref.push.assign(n, {});
+        ref.los.assign(n, 0.f);
+    }
+
+    r.queries.push_back(Time("ray", n, [&](BVHQueryStats& s, size_t& hits, size_t& bad) {
+        for (size_t i = 0; i < n; ++i) {
+            float t = 100.f; Vector3 nrm;
+            bvh.Raycast(q.rayOrigin[i], q.rayDir[i], t, nrm, &s);
+            hits += t < 100.f;
+            if (first) ref.ray[i] = t; else bad += !Same(t, ref.ray[i]);
+        }
+    }));
+    r.queries.push_back(Time("sweep", n, [&](BVHQueryStats& s, size_t& hits, size_t& bad) {
+        for (size_t i = 0; i < n; ++i) {
+            float t = FLT_MAX; Vector3 nrm;
+            bvh.SweepSphere(q.sweepStart[i], q.sweepEnd[i], 0.5f, t, nrm, &s);
+            hits += t <= 1.f;
+            if (first) ref.sweep[i] = t; else bad += !Same(t, ref.sweep[i]);
+        }
+    }));
+    r.queries.push_back(Time("resolve", n, [&](BVHQueryStats& s, size_t& hits, size_t& bad) {
+        for (size_t i = 0; i < n; ++i) {
+            Vector3 push = { 0, 0, 0 }; bool pushed = false;
+            bvh.ResolveSphere(q.sphere[i], 0.5f, push, pushed, &s);
+            hits += pushed;
+            // Accumulation order follows leaf order, so allow float slack.
+            if (first) ref.push[i] = push;
+            else bad += !(Same(push.x, ref.push[i].x) && Same(push.y, ref.push[i].y) && Same(push.z, ref.push[i].z));
+        }
+    }));
+    r.queries.push_back(Time("los", n, [&](BVHQueryStats& s, size_t& hits, size_t& bad) {
+        for (size_t i = 0; i < n; ++i) {
+            float t = 1.f; Vector3 nrm;
+            bvh.Raycast(q.losOrigin[i], q.losDir[i], t, nrm, &s);
+            hits += t < 1.f;
+            if (first) ref.los[i] = t; else bad += !Same(t, ref.los[i]);
+        }
+    }));
+    r.queries.push_back(Time("los4", n, [&](BVHQueryStats& s, size_t& hits, size_t& bad) {
+        for (size_t i = 0; i < n; i += 4) {
+            const size_t lanes = std::min<size_t>(4, n - i);
+            Vector3 ro[4] = {}, rd[4] = {}, nrm[4];
+            float   t[4]  = { -1.f, -1.f, -1.f, -1.f };
+            for (size_t k = 0; k < lanes; ++k) {
+                ro[k] = q.losOrigin[i + k]; rd[k] = q.losDir[i + k]; t[k] = 1.f;
+            }
+            bvh.Raycast4(ro, rd, t, nrm, &s);
+            for (size_t k = 0; k < lanes; ++k) {
+                hits += t[k] < 1.f;
+                bad  += !Same(t[k], ref.los[i + k]);
+            }
+        }
+    }));
+}
+
+Result Run(const Builder& builder, const std::vector<Tri>& mesh, const Queries& q, Answers& ref, bool first,
+           Hotones::ECS::JobSystem* jobs) {
+    const bool wide4 = builder.options.layout == BVHLayout::Wide4;
+    Result r{};
+    r.builder = builder.name;
+    r.layout  = wide4 ? "wide4" : "binary";
+
+    std::vector<double> ms;
+    BVH  bvh;
+    BVH4 wide;
+    for (int i = 0; i < 5; ++i) {
+        std::vector<Tri> copy = mesh;
+        const auto t0 = Clock::now();
+        bvh.Build(std::move(copy), builder.options, jobs);
+        double buildMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        if (i == 4) {                               // shape of the binary tree, untimed
+            r.nodes  = bvh.nodes.size();
+            r.leaves = 0;
+            r.depth  = 0;
+            Walk(bvh, 0, 0, r.leaves, r.depth);
+            r.sahCost = bvh.SahCost(builder.options);
+        }
+        if (wide4) {
+            const auto t1 = Clock::now();
+            wide.Collapse(std::move(bvh));
+            buildMs += std::chrono::duration<double, std::milli>(Clock::now() - t1).count();
+        }
+        ms.push_back(buildMs);
+    }
+    std::sort(ms.begin(), ms.end());
+    r.buildMs = ms[ms.size() / 2];
+
+    if (wide4) {
+        r.wideNodes = wide.nodes.size();
+        r.packets   = wide.packets.size();
+        RunQueries(wide, q, ref, first, r);
+    } else {
+        RunQueries(bvh, q, ref, first, r);
+    }
+
+    std::fprintf(stderr, "  %-12s build %8.2f ms  nodes %8zu  depth %3d  sah %8.2f",
+                 r.builder.c_str(), r.buildMs, r.nodes, r.depth, r.sahCost);
+    if (wide4) std::fprintf(stderr, "  wide nodes %zu  packets %zu", r.wideNodes, r.packets);
+    std::fprintf(stderr, "\n");
+    for (const QueryResult& qr : r.queries)
+        std::fprintf(stderr, "               %-8s %8.1f ns  %7.2f M/s  %7.1f nodes  %7.1f tris  %zu mismatches\n",
+                     qr.kind, qr.nsPerQuery, 1e3 / qr.nsPerQuery, qr.nodesPerQuery, qr.trisPerQuery,
+                     qr.mismatches);
+    return r;
+}
+
+// ---- Output ---------------------------------------------------------------
+
+const char* CompilerName() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+void PrintJson(const std::string& mesh, size_t tris, unsigned workers, const std::vector<Result>& results)
+{
+    std::printf("{\n");
+    std::printf("  \"suite\": \"physics\",\n");
+    std::printf("  \"schema\": 2,\n");
+    std::printf("  \"compiler\": \"%s\",\n", CompilerName());
+    std::printf("  \"mesh\": \"%s\",\n", mesh.c_str());
+    std::printf("  \"triangles\": %zu,\n", tris);
+    std::printf("  \"build_workers\": %u,\n", workers);
+    std::printf("  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        std::printf("    { \"builder\": \"%s\", \"layout\": \"%s\", \"build_ms\": %.3f, \"nodes\": %zu, "
+                    "\"leaves\": %zu, \"depth\": %d, \"sah_cost\": %.3f, \"wide_nodes\": %zu, "
+                    "\"packets\": %zu, \"queries\": [\n",
+                    r.builder.c_str(), r.layout, r.buildMs, r.nodes, r.leaves, r.depth, r.sahCost,
+                    r.wideNodes, r.packets);
+        for (size_t k = 0; k < r.queries.size(); ++k) {
+            const QueryResult& q = r.queries[k];
+            std::printf("        { \"kind\": \"%s\", \"ns_per_query\": %.2f, \"queries_per_sec\": %.0f, "
+                        "\"nodes_per_query\": %.2f, \"tris_per_query\": %.2f, \"hits\": %zu, "
+                        "\"mismatches\": %zu }%s\n",
+                        q.kind, q.nsPerQuery, 1e9 / q.nsPerQuery, q.nodesPerQuery, q.trisPerQuery, q.hits,
+                        q.mismatches, k + 1 < r.queries.size() ? "," : "");
+        }
+        std::printf("    ] }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+}
+
+bool ParseArgs(int argc, char** argv, Options& opt)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--obj=", 6) == 0) {
+            opt.obj = arg + 6;
+        } else if (std::strncmp(arg, "--rooms=", 8) == 0) {
+            opt.rooms = std::atoi(arg + 8);
+            if (opt.rooms <= 0) return false;
+        } else if (std::strncmp(arg, "--queries=", 10) == 0) {
+            opt.queries = std::strtoull(arg + 10, nullptr, 10);
+            if (opt.queries == 0) return false;
+        } else if (std::strncmp(arg, "--workers=", 10) == 0) {
+            opt.workers = (unsigned)std::strtoul(arg + 10, nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options opt;
+    if (!ParseArgs(argc, argv, opt)) {
+        std::fprintf(stderr, "usage: physics_bench [--obj=mesh.obj] [--rooms=N] [--queries=N] [--workers=N]\n");
+        return 2;
+    }
+
+    std::vector<Tri> mesh;
+    std::string      meshName;
+    if (!opt.obj.empty()) {
+        if (!LoadObj(opt.obj, mesh)) {
+            std::fprintf(stderr, "physics_bench: cannot load '%s'\n", opt.obj.c_str());
+            return 1;
+        }
+        meshName = opt.obj;
+    } else {
+        mesh     = GenerateLevel(opt.rooms);
+        meshName = "generated:" + std::to_string(opt.rooms) + "x" + std::to_string(opt.rooms);
+    }
+    std::fprintf(stderr, "physics_bench: %s, %zu triangles, %zu queries per kind\n",
+                 meshName.c_str(), mesh.size(), opt.queries);
+
+    BVHBuildOptions mean;
+    mean.builder = BVHBuilder::Mean;
+    BVHBuildOptions sah16;
+    sah16.builder = BVHBuilder::BinnedSAH;
+    BVHBuildOptions sah32 = sah16;
+    sah32.bins = 32;
+    BVHBuildOptions meanWide = mean, sah16Wide = sah16;
+    meanWide.layout  = BVHLayout::Wide4;
+    sah16Wide.layout = BVHLayout::Wide4;
+    const Builder builders[] = { { "mean", mean }, { "sah16", sah16 }, { "sah32", sah32 },
+                                 { "mean-wide4", meanWide }, { "sah16-wide4", sah16Wide } };
+
+    std::unique_ptr<Hotones::ECS::JobSystem> jobs;
+    if (opt.workers) jobs = std::make_unique<Hotones::ECS::JobSystem>(opt.workers);
+
+    const Queries q = MakeQueries(mesh, opt.queries);
+    Answers ref;
+    std::vector<Result> results;
+    for (const Builder& b : builders)
+        results.push_back(Run(b, mesh, q, ref, results.empty(), jobs.get()));
+
+    PrintJson(meshName, mesh.size(), opt.workers, results);
+    return 0;
+}
@@ -117,6 +117,14 @@ bool CollidableModel::CheckCollision(Vector3 point) const {
            (point.z >= bbox.min.z && point.z <= bbox.max.z);
 }
 
+bool CollidableModel::IsPhysicsReady() const {
+    return physicsHandle != -1 && Hotones::Physics::IsStaticMeshReady(physicsHandle);
+}
+
+bool CollidableModel::WaitForPhysics(float timeoutSeconds) const {
+    return physicsHandle != -1 && Hotones::Physics::WaitForStaticMesh(physicsHandle, timeoutSeconds);
+}
+
 bool CollidableModel::ResolveSphereCollision(Vector3 &center, float radius) {
     if (physicsHandle == -1) return false;
     return Hotones::Physics::ResolveSphereAgainstStatic(physicsHandle, center, radius);
@@ -143,6 +143,22 @@ std::vector<const SceneNode*> ImportedScene::FindNodesByName(const std::string&
     return out;
 }
 
+bool ImportedScene::IsPhysicsReady() const {
+    for (const auto& sm : meshes)
+        if (sm.physicsHandle != -1 && !Physics::IsStaticMeshReady(sm.physicsHandle)) return false;
+    return true;
+}
+
+bool ImportedScene::WaitForPhysics(float timeoutSeconds) const {
+    const double deadline = GetTime() + timeoutSeconds;
+    for (const auto& sm : meshes) {
+        if (sm.physicsHandle == -1) continue;
+        float left = timeoutSeconds < 0.f ? -1.f : (float)std::max(0.0, deadline - GetTime());
+        if (!Physics::WaitForStaticMesh(sm.physicsHandle, left)) return false;
+    }
+    return true;
+}
+
 void ImportedScene::Unload() {
     for (auto& sm : meshes) {
         UnloadMesh(sm.mesh);
@@ -3,6 +3,11 @@
 #include <GFX/LightingSystem.hpp>
 #include <GFX/Player.hpp>
 #include <ECS/Components.hpp>
+#include <ECS/LifetimeSystem.hpp>
+#include <ECS/MortonSortSystem.hpp>
+#include <ECS/SpatialIndexSystem.hpp>
+#include <ECS/TransformPropagationSystem.hpp>
+#include <Physics/PhysicsSystem.hpp>
 #include <Scripting/CupLoader.hpp>
 #include <Scripting/LuaLoader/ECS.hpp>
 #include <server/NetworkManager.hpp>
@@ -14,6 +19,23 @@ namespace Hotones {
 ScriptedScene::ScriptedScene(Scripting::CupLoader* script)
     : m_script(script)
 {
+    m_systems.Add<ECS::LifetimeSystem>();
+    m_systems.Add<ECS::TransformPropagationSystem>();
+    m_spatial = &m_systems.Add<ECS::SpatialIndexSystem>();
+    m_systems.Add<ECS::MortonSortSystem>();
+
+    // Release resources owned by components when they go away (entity
+    // destroyed, component removed or the registry cleared on Unload).
+    m_registry.OnDestroy<ECS::RenderModelComponent>(
+        [](ECS::Registry&, std::span<const ECS::EntityId>, std::span<ECS::RenderModelComponent> models) {
+            for (auto& rm : models)
+                if (rm.ownsModel) UnloadModel(rm.model);
+        });
+    m_registry.OnDestroy<ECS::ColliderSphereComponent>(
+        [](ECS::Registry&, std::span<const ECS::EntityId>, std::span<ECS::ColliderSphereComponent> colliders) {
+            for (auto& c : colliders)
+                if (c.physicsHandle != -1) Physics::UnregisterStaticMesh(c.physicsHandle);
+        });
 }
 
 ScriptedScene::~ScriptedScene()
@@ -23,6 +45,7 @@ ScriptedScene::~ScriptedScene()
 
 void ScriptedScene::Init()
 {
+    m_loaded = true;
     DisableCursor();
 
     m_player.body.position = { 0.f, 0.f, 0.f };
@@ -41,9 +64,15 @@ void ScriptedScene::Init()
     // position and look direction without shadow-tracking.
     if (m_script) m_script->setLocalPlayer(&m_player);
 
+    // Size the ECS arena and pools from the pack's Init.ECS hints before
+    // anything is spawned.
+    if (m_script) Hotones::Scripting::LuaLoader::reserveECS(m_registry, m_script->ecsMemoryHints());
+
     // Expose the ECS registry and local player to the `ecs.*` Lua library.
     Hotones::Scripting::LuaLoader::setECSRegistry(&m_registry);
     Hotones::Scripting::LuaLoader::setECSLocalPlayer(&m_player);
+    m_systems.Init(m_registry);
+    Hotones::Scripting::LuaLoader::setECSSpatialIndex(m_spatial);
 
     // Initialise lighting (idempotent; safe if already done).
     auto& ls = GFX::LightingSystem::Get();
@@ -54,6 +83,10 @@ void ScriptedScene::Init()
         m_world = std::make_shared<CollidableModel>(
             m_script->mainScenePath(), Vector3{0.f, 0.f, 0.f});
         m_player.AttachWorld(m_world);
+        // Collision is built on the physics workers; hold the first frame
+        // until it is ready so the player does not fall through the level.
+        if (!m_world->WaitForPhysics(10.f))
+            TraceLog(LOG_WARNING, "ScriptedScene: world collision not ready after 10 s, continuing");
         // Patch every material in the world model to use the lighting shader.
         if (ls.IsReady()) m_world->SetShader(ls.GetShader());
     }
@@ -72,22 +105,17 @@ void ScriptedScene::Update()
 
     // Keep TransformComponent in sync with the engine player's live position
     // so Lua can read ecs.getPos(playerEntityId) and get an up-to-date value.
-    m_registry.Each<ECS::PlayerComponent>(
-        [&](ECS::EntityId id, ECS::PlayerComponent& pc) {
+    m_registry.Each<const ECS::PlayerComponent>(
+        [&](ECS::EntityId id, const ECS::PlayerComponent& pc) {
             if (!pc.player) return;
             if (m_registry.HasComponent<ECS::TransformComponent>(id))
                 m_registry.GetComponent<ECS::TransformComponent>(id).position =
                     pc.player->body.position;
         });
 
-    // Tick lifetime components and collect expired entities.
-    std::vector<ECS::EntityId> toDestroy;
-    m_registry.Each<ECS::LifetimeComponent>(
-        [&](ECS::EntityId id, ECS::LifetimeComponent& lt) {
-            lt.remaining -= dt;
-            if (lt.remaining <= 0.0f) toDestroy.push_back(id);
-        });
-    for (auto id : toDestroy) m_registry.DestroyEntity(id);
+    // Script-free systems (lifetimes, ...). Non-conflicting ones run in
+    // parallel on the job pool; see ECS/SystemScheduler.hpp.
+    m_systems.Update(m_registry, dt);
 
     if (m_script) m_script->update();
 }
@@ -138,8 +166,17 @@ void ScriptedScene::Draw()
 
 void ScriptedScene::Unload()
 {
+    // Runs from SceneManager::SwitchTo and again from the destructor; the
+    // second call (or one without Init) must not touch the ECS globals,
+    // which may belong to the next scene by then.
+    if (!m_loaded) return;
+    m_loaded = false;
     if (m_world) m_world.reset();
-    m_registry.Clear();
+    Hotones::Scripting::LuaLoader::setECSSpatialIndex(nullptr);
+    m_systems.Shutdown(m_registry);
+    // Destroys every entity (OnDestroy handlers release models / physics),
+    // then frees all pool memory with a single arena reset.
+    m_registry.ReleaseMemory();
     // Null out the static pointer so stale Lua calls after scene teardown
     // are silently ignored rather than crashing.
     Hotones::Scripting::LuaLoader::setECSRegistry(nullptr);
@@ -2,6 +2,13 @@
 #include <server/NetworkManager.hpp>
 #include <Scripting/CupLoader.hpp>
 #include <Scripting/CupPackage.hpp>
+#include <Scripting/LuaLoader/ECS.hpp>
+#include <ECS/Registry.hpp>
+#include <ECS/SystemScheduler.hpp>
+#include <ECS/LifetimeSystem.hpp>
+#include <ECS/MortonSortSystem.hpp>
+#include <ECS/SpatialIndexSystem.hpp>
+#include <ECS/TransformPropagationSystem.hpp>
 
 #include <atomic>
 #include <chrono>
@@ -45,6 +52,20 @@ void RunHeadlessServer(uint16_t port, const std::string& pakPath) {
         std::cout << "\n";
     }
 
+    // -- ECS ------------------------------------------------------------------
+    // Server-side world. Script-free systems go through the scheduler so
+    // they spread over every core instead of sharing the tick thread.
+    ECS::Registry        registry;
+    ECS::SystemScheduler systems;
+    if (hasPak) Hotones::Scripting::LuaLoader::reserveECS(registry, script.ecsMemoryHints());
+    systems.Add<ECS::LifetimeSystem>();
+    systems.Add<ECS::TransformPropagationSystem>();
+    auto& spatial = systems.Add<ECS::SpatialIndexSystem>();
+    systems.Add<ECS::MortonSortSystem>();
+    systems.Init(registry);
+    Hotones::Scripting::LuaLoader::setECSRegistry(&registry);
+    Hotones::Scripting::LuaLoader::setECSSpatialIndex(&spatial);
+
     // -- Network --------------------------------------------------------------
     Net::NetworkManager server;
 
@@ -89,6 +110,8 @@ void RunHeadlessServer(uint16_t port, const std::string& pakPath) {
 
     if (!server.StartServer(port)) {
         std::cerr << "[Server] Failed to start on port " << port << "\n";
+        Hotones::Scripting::LuaLoader::setECSSpatialIndex(nullptr);
+        Hotones::Scripting::LuaLoader::setECSRegistry(nullptr);
         return;
     }
 
@@ -96,13 +119,22 @@ void RunHeadlessServer(uint16_t port, const std::string& pakPath) {
     std::cout << "[Server] Press Ctrl+C to shut down.\n";
 
     // -- Main loop ------------------------------------------------------------
+    auto lastTick = std::chrono::steady_clock::now();
     while (g_serverRunning.load()) {
+        const auto  now = std::chrono::steady_clock::now();
+        const float dt  = std::chrono::duration<float>(now - lastTick).count();
+        lastTick = now;
+
         server.Update();
+        systems.Update(registry, dt);
         if (hasPak) script.update();
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
     std::cout << "\n[Server] Shutting down...\n";
+    Hotones::Scripting::LuaLoader::setECSSpatialIndex(nullptr);
+    systems.Shutdown(registry);
+    Hotones::Scripting::LuaLoader::setECSRegistry(nullptr);
     server.StopServer();
     std::cout << "[Server] Goodbye!\n";
 }
@@ -0,0 +1,779 @@
+// Triangle BVH: builders and query kernels (see Physics/BVH.hpp).
+//
+// Builders (BVHBuildOptions::builder):
+//   Mean      — split the longest axis at the centroid mean; O(n log n), cheap
+//   BinnedSAH — per axis, bin centroids into `bins` buckets and pick the plane
+//               minimising the surface-area heuristic
+//                   cost = Ct + Ci * (A_L * N_L + A_R * N_R) / A
+//               against the cost of a leaf, Ci * N. Nodes above maxLeafSize
+//               are always split; when every centroid coincides the mean
+//               split (and its halving fallback) takes over.
+//
+// Sphere-vs-triangle sweep:
+//   We cast a ray from (start) to (end) against the "inflated" geometry of each
+//   triangle (the Minkowski sum of the triangle with a sphere of the given radius).
+//   That Minkowski sum consists of:
+//     1. The triangle face (ray vs plane, clamped to triangle)
+//     2. Three edge capsules (ray vs infinite cylinder for each edge)
+//     3. Three vertex spheres
+//   We return the earliest parametric hit t ∈ [0,1].
+
+#include <Physics/BVH.hpp>
+#include <ECS/JobSystem.hpp>
+#include <algorithm>
+#include <cfloat>
+#include <raymath.h>
+
+namespace Hotones { namespace Physics {
+
+// ─── Geometry helpers (file-internal) ────────────────────────────────────────
+
+static inline float v3dot(Vector3 a, Vector3 b) { return Vector3DotProduct(a, b); }
+static inline float v3len(Vector3 a)             { return Vector3Length(a); }
+static inline Vector3 v3norm(Vector3 a)           { return Vector3Normalize(a); }
+static inline Vector3 v3sub(Vector3 a, Vector3 b) { return Vector3Subtract(a, b); }
+static inline Vector3 v3add(Vector3 a, Vector3 b) { return Vector3Add(a, b); }
+static inline Vector3 v3scale(Vector3 a, float s) { return Vector3Scale(a, s); }
+static inline Vector3 v3cross(Vector3 a, Vector3 b){ return Vector3CrossProduct(a, b); }
+
+// Closest point on triangle (abc) to point p — Ericson §5.1.5
+static Vector3 ClosestPtTriangle(Vector3 p, Vector3 a, Vector3 b, Vector3 c) {
+    Vector3 ab = v3sub(b,a), ac = v3sub(c,a), ap = v3sub(p,a);
+    float d1 = v3dot(ab,ap), d2 = v3dot(ac,ap);
+    if (d1 <= 0.f && d2 <= 0.f) return a;
+
+    Vector3 bp = v3sub(p,b);
+    float d3 = v3dot(ab,bp), d4 = v3dot(ac,bp);
+    if (d3 >= 0.f && d4 <= d3) return b;
+
+    float vc = d1*d4 - d3*d2;
+    if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+        float v = d1 / (d1 - d3);
+        return v3add(a, v3scale(ab, v));
+    }
+
+    Vector3 cp = v3sub(p,c);
+    float d5 = v3dot(ab,cp), d6 = v3dot(ac,cp);
+    if (d6 >= 0.f && d5 <= d6) return c;
+
+    float vb = d5*d2 - d1*d6;
+    if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+        float w = d2 / (d2 - d6);
+        return v3add(a, v3scale(ac, w));
+    }
+
+    float va = d3*d6 - d5*d4;
+    float denom = d4 - d3 + d5 - d6;
+    if (va <= 0.f && denom > 0.f) {
+        float w = (d4 - d3) / denom;
+        return v3add(b, v3scale(v3sub(c,b), w));
+    }
+
+    float dv = 1.f / (va + vb + vc);
+    float vv = vb * dv, wv = vc * dv;
+    return v3add(a, v3add(v3scale(ab,vv), v3scale(ac,wv)));
+}
+
+// Analytic ray-vs-sphere: ray o+t*d, sphere center c radius r.
+// Returns t of first intersection, or FLT_MAX if none in [tMin,tMax].
+static float RaySphere(Vector3 o, Vector3 d, Vector3 c, float r, float tMin, float tMax) {
+    Vector3 oc = v3sub(o, c);
+    float A = v3dot(d,d);
+    float B = 2.f * v3dot(oc, d);
+    float C = v3dot(oc, oc) - r*r;
+    float disc = B*B - 4.f*A*C;
+    if (disc < 0.f) return FLT_MAX;
+    float sqrtD = sqrtf(disc);
+    float t = (-B - sqrtD) / (2.f*A);
+    if (t >= tMin && t <= tMax) return t;
+    t = (-B + sqrtD) / (2.f*A);
+    if (t >= tMin && t <= tMax) return t;
+    return FLT_MAX;
+}
+
+// Analytic ray-vs-infinite-cylinder (axis a→b, radius r).
+// Returns t of first lateral intersection, or FLT_MAX if none.
+static float RayCylinder(Vector3 ro, Vector3 rd, Vector3 a, Vector3 b, float r, float tMin, float tMax) {
+    Vector3 ab  = v3sub(b, a);
+    Vector3 ao  = v3sub(ro, a);
+    float abLen2 = v3dot(ab, ab);
+    if (abLen2 < 1e-10f) return FLT_MAX;
+
+    // Project rd and ao onto plane perpendicular to ab
+    float rdDotAb = v3dot(rd, ab) / abLen2;
+    float aoDotAb = v3dot(ao, ab) / abLen2;
+    Vector3 d_perp = v3sub(rd, v3scale(ab, rdDotAb));
+    Vector3 o_perp = v3sub(ao, v3scale(ab, aoDotAb));
+
+    float A = v3dot(d_perp, d_perp);
+    float B = 2.f * v3dot(o_perp, d_perp);
+    float C = v3dot(o_perp, o_perp) - r*r;
+    float disc = B*B - 4.f*A*C;
+    if (disc < 0.f || A < 1e-10f) return FLT_MAX;
+    float sqrtD = sqrtf(disc);
+    float t = (-B - sqrtD) / (2.f*A);
+    if (t < tMin || t > tMax) {
+        t = (-B + sqrtD) / (2.f*A);
+        if (t < tMin || t > tMax) return FLT_MAX;
+    }
+    // Check that the hit lies between a and b along the cylinder axis
+    Vector3 hitPt = v3add(ro, v3scale(rd, t));
+    float proj = v3dot(v3sub(hitPt, a), ab) / abLen2;
+    if (proj < 0.f || proj > 1.f) return FLT_MAX;
+    return t;
+}
+
+// ─── Exact triangle tests (shared with BVH4) ─────────────────────────────────
+
+namespace detail {
+
+// Continuous sphere vs triangle sweep.
+// Returns t ∈ [0, segLen/segLen=1] of first contact, FLT_MAX if no hit.
+// outNormal filled with the contact normal at impact.
+float SweepSphereTriangle(Vector3 start, Vector3 end, float radius,
+                          Vector3 ta, Vector3 tb, Vector3 tc,
+                          Vector3& outNormal) {
+    Vector3 d    = v3sub(end, start);
+    float segLen = v3len(d);
+    if (segLen < 1e-10f) return FLT_MAX;
+
+    Vector3 triNorm = v3norm(v3cross(v3sub(tb,ta), v3sub(tc,ta)));
+    float bestT = FLT_MAX;
+    Vector3 bestN = triNorm;
+
+    // ── 1. Ray vs face (inflated by radius along normal) ─────────────────────
+    {
+        float nDotD = v3dot(triNorm, d);
+        if (fabsf(nDotD) > 1e-8f) {
+            // Inflate plane by radius toward sphere origin
+            for (int sign = -1; sign <= 1; sign += 2) {
+                Vector3 planePoint = v3add(ta, v3scale(triNorm, sign * radius));
+                float nDotOs = v3dot(triNorm, v3sub(planePoint, start));
+                float t = nDotOs / nDotD;
+                if (t >= 0.f && t < bestT) {
+                    // Check if hit point (back-projected onto triangle plane) is inside triangle
+                    Vector3 hitPt    = v3add(start, v3scale(d, t));
+                    Vector3 onPlane  = v3sub(hitPt, v3scale(triNorm, sign * radius));
+                    Vector3 closest  = ClosestPtTriangle(onPlane, ta, tb, tc);
+                    if (v3len(v3sub(onPlane, closest)) < 1e-4f) {
+                        bestT = t;
+                        bestN = v3scale(triNorm, (float)sign);
+                    }
+                }
+            }
+        }
+    }
+
+    // ── 2. Ray vs edge capsules ───────────────────────────────────────────────
+    Vector3 edges[3][2] = { {ta,tb}, {tb,tc}, {tc,ta} };
+    for (auto& e : edges) {
+        float t = RayCylinder(start, d, e[0], e[1], radius, 0.f, bestT);
+        if (t < bestT) {
+            // Compute normal = (hitPoint - closestPointOnEdge) normalised
+            Vector3 hitPt   = v3add(start, v3scale(d, t));
+            Vector3 ab      = v3sub(e[1], e[0]);
+            float abL2      = v3dot(ab,ab);
+            float proj      = abL2 > 1e-10f ? v3dot(v3sub(hitPt, e[0]), ab) / abL2 : 0.f;
+            proj             = proj < 0.f ? 0.f : (proj > 1.f ? 1.f : proj);
+            Vector3 closest = v3add(e[0], v3scale(ab, proj));
+            Vector3 n       = v3sub(hitPt, closest);
+            float nlen      = v3len(n);
+            if (nlen > 1e-6f) {
+                bestT = t;
+                bestN = v3scale(n, 1.f/nlen);
+            }
+        }
+    }
+
+    // ── 3. Ray vs vertex spheres ──────────────────────────────────────────────
+    Vector3 verts[3] = { ta, tb, tc };
+    for (auto& v : verts) {
+        float t = RaySphere(start, d, v, radius, 0.f, bestT);
+        if (t < bestT) {
+            Vector3 hitPt = v3add(start, v3scale(d, t));
+            Vector3 n     = v3sub(hitPt, v);
+            float nlen    = v3len(n);
+            if (nlen > 1e-6f) {
+                bestT = t;
+                bestN = v3scale(n, 1.f/nlen);
+            }
+        }
+    }
+
+    if (bestT > 1.f + 1e-6f) return FLT_MAX; // no hit within segment
+    outNormal = bestN;
+    return bestT;
+}
+
+// Möller-Trumbore ray-vs-triangle. Returns t > 0 on hit, FLT_MAX otherwise.
+// Fills outNormal with the face normal flipped toward the ray origin.
+float RayTriangleMT(Vector3 ro, Vector3 rd,
+                    Vector3 ta, Vector3 tb, Vector3 tc,
+                    Vector3& outNormal) {
+    const float EPS = 1e-8f;
+    Vector3 e1  = v3sub(tb, ta);
+    Vector3 e2  = v3sub(tc, ta);
+    Vector3 h   = v3cross(rd, e2);
+    float   a   = v3dot(e1, h);
+    if (fabsf(a) < EPS) return FLT_MAX;   // Ray parallel to triangle
+    float   f   = 1.f / a;
+    Vector3 s   = v3sub(ro, ta);
+    float   u   = f * v3dot(s, h);
+    if (u < 0.f || u > 1.f) return FLT_MAX;
+    Vector3 q   = v3cross(s, e1);
+    float   v   = f * v3dot(rd, q);
+    if (v < 0.f || u + v > 1.f) return FLT_MAX;
+    float   t   = f * v3dot(e2, q);
+    if (t < 1e-6f) return FLT_MAX;        // Behind ray origin
+    Vector3 n = v3norm(v3cross(e1, e2));
+    // Flip so the normal faces the incoming ray
+    if (v3dot(n, rd) > 0.f) n = v3scale(n, -1.f);
+    outNormal = n;
+    return t;
+}
+
+// Sphere vs triangle penetration: adds the push-out along the separating
+// direction to outPush and returns true when they overlap.
+bool SpherePushOut(Vector3 center, float radius, const Tri& tri, Vector3& outPush) {
+    Vector3 closest = ClosestPtTriangle(center, tri.a, tri.b, tri.c);
+    Vector3 diff    = v3sub(center, closest);
+    float dist2     = v3dot(diff, diff);
+    if (dist2 >= radius * radius) return false;
+    float dist = sqrtf(dist2);
+    Vector3 n;
+    if (dist > 1e-6f) {
+        n = v3scale(diff, 1.f / dist);
+    } else {
+        // Center is on the triangle — push out along face normal
+        n = v3norm(v3cross(v3sub(tri.b, tri.a), v3sub(tri.c, tri.a)));
+    }
+    float depth = radius - dist;
+    outPush = v3add(outPush, v3scale(n, depth));
+    return true;
+}
+
+} // namespace detail
+
+// ─── Build ───────────────────────────────────────────────────────────────────
+
+namespace {
+
+// Per-triangle bounds and centroid, partitioned in place while building; the
+// triangle array is reordered to match once at the end.
+struct BuildRef {
+    Vector3 bmin, bmax, centroid;
+    int     tri;
+};
+
+struct Bounds {
+    Vector3 bmin = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+    Vector3 bmax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    void Grow(Vector3 mn, Vector3 mx) {
+        bmin = { std::min(bmin.x, mn.x), std::min(bmin.y, mn.y), std::min(bmin.z, mn.z) };
+        bmax = { std::max(bmax.x, mx.x), std::max(bmax.y, mx.y), std::max(bmax.z, mx.z) };
+    }
+    void Grow(const Bounds& o) { Grow(o.bmin, o.bmax); }
+
+    // Half the surface area — the constant factor cancels in every SAH ratio.
+    float HalfArea() const {
+        if (bmin.x > bmax.x) return 0.f;
+        Vector3 e = v3sub(bmax, bmin);
+        return e.x * e.y + e.y * e.z + e.z * e.x;
+    }
+};
+
+static constexpr int MAX_BINS = 32;
+
+struct Builder {
+    const BVHBuildOptions& opt;
+    std::vector<BuildRef>& refs;
+    std::vector<BVHNode>&  nodes;
+    int                    bins;
+    ECS::JobSystem*        jobs;
+
+    int BuildNode(int start, int end, int depth) {
+        int nodeIdx = (int)nodes.size();
+        nodes.push_back({});
+
+        Bounds box, cbox;
+        for (int i = start; i < end; ++i) {
+            box.Grow(refs[i].bmin, refs[i].bmax);
+            cbox.Grow(refs[i].centroid, refs[i].centroid);
+        }
+        nodes[nodeIdx].bmin = box.bmin;
+        nodes[nodeIdx].bmax = box.bmax;
+
+        int count = end - start;
+        int split = -1;
+        if (count > 1 && depth < BVH::MAX_DEPTH - 1) {
+            split = opt.builder == BVHBuilder::BinnedSAH ? SplitSAH(start, end, box, cbox)
+                                                         : SplitMean(start, end, box);
+        }
+        if (split < 0) {
+            nodes[nodeIdx].triStart   = start;
+            nodes[nodeIdx].triCount   = count;
+            nodes[nodeIdx].rightChild = -1;
+            return nodeIdx;
+        }
+
+        nodes[nodeIdx].triStart = -1;
+        nodes[nodeIdx].triCount = 0;
+        if (jobs && count >= opt.parallelMinTris) {
+            nodes[nodeIdx].rightChild = BuildParallel(start, split, end, depth + 1);
+            return nodeIdx;
+        }
+        BuildNode(start, split, depth + 1);                   // left child (always nodeIdx+1)
+        int right = BuildNode(split, end, depth + 1);         // right child
+        nodes[nodeIdx].rightChild = right;                    // index: vector may have grown
+        return nodeIdx;
+    }
+
+    // Build [start, split) here and [split, end) as a job into node arrays of
+    // their own (the reference ranges are disjoint), then append both. Returns
+    // the index of the right child.
+    int BuildParallel(int start, int split, int end, int depth) {
+        std::vector<BVHNode> leftNodes, rightNodes;
+        leftNodes.reserve((size_t)(split - start) * 2);
+        rightNodes.reserve((size_t)(end - split) * 2);
+        Builder left { opt, refs, leftNodes,  bins, jobs };
+        Builder right{ opt, refs, rightNodes, bins, jobs };
+
+        ECS::JobSystem::Counter done;
+        jobs->Submit([&right, split, end, depth] { right.BuildNode(split, end, depth); }, done);
+        left.BuildNode(start, split, depth);
+        jobs->Wait(done);
+
+        Append(leftNodes);
+        return Append(rightNodes);
+    }
+
+    // Append a subtree built with local indices; returns its root index.
+    int Append(const std::vector<BVHNode>& sub) {
+        int base = (int)nodes.size();
+        for (BVHNode n : sub) {
+            if (n.rightChild != -1) n.rightChild += base;
+            nodes.push_back(n);
+        }
+        return base;
+    }
+
+    // Longest axis, centroid mean. Returns the split index or -1 for a leaf.
+    int SplitMean(int start, int end, const Bounds& box) {
+        int count = end - start;
+        if (count <= opt.maxLeafSize) return -1;
+
+        Vector3 ext = v3sub(box.bmax, box.bmin);
+        int axis = (ext.x > ext.y && ext.x > ext.z) ? 0 : (ext.y > ext.z ? 1 : 2);
+        float mid = 0.f;
+        for (int i = start; i < end; ++i) mid += (&refs[i].centroid.x)[axis];
+        mid /= (float)count;
+
+        auto midIt = std::partition(refs.begin() + start, refs.begin() + end,
+                                    [axis, mid](const BuildRef& r) {
+                                        return (&r.centroid.x)[axis] < mid;
+                                    });
+        int split = (int)(midIt - refs.begin());
+        if (split == start || split == end) split = start + count / 2;
+        return split;
+    }
+
+    // Binned SAH over all three axes. Returns the split index or -1 for a leaf.
+    int SplitSAH(int start, int end, const Bounds& box, const Bounds& cbox) {
+        int count = end - start;
+
+        // Bin every axis in one pass over the references. Small nodes use
+        // fewer bins — there are not more candidate planes than triangles.
+        int    nb = std::min(bins, std::max(count, 4));
+        float  cmin[3], scale[3];
+        bool   valid[3];
+        Bounds binBox[3][MAX_BINS];
+        int    binCount[3][MAX_BINS];
+        for (int axis = 0; axis < 3; ++axis)
+            for (int b = 0; b < nb; ++b) { binBox[axis][b] = Bounds{}; binCount[axis][b] = 0; }
+        for (int axis = 0; axis < 3; ++axis) {
+            cmin[axis]  = (&cbox.bmin.x)[axis];
+            float cext  = (&cbox.bmax.x)[axis] - cmin[axis];
+            valid[axis] = cext > 1e-12f;
+            scale[axis] = valid[axis] ? (float)nb / cext : 0.f;
+        }
+        for (int i = start; i < end; ++i) {
+            const BuildRef& r = refs[i];
+            for (int axis = 0; axis < 3; ++axis) {
+                int b = BinOf((&r.centroid.x)[axis], cmin[axis], scale[axis], nb);
+                ++binCount[axis][b];
+                binBox[axis][b].Grow(r.bmin, r.bmax);
+            }
+        }
+
+        float bestCost = FLT_MAX;
+        int   bestAxis = -1, bestBin = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!valid[axis]) continue;
+
+            // Sweep right → left for the right-side areas, then left → right.
+            float  rightArea[MAX_BINS];
+            int    rightCount[MAX_BINS];
+            Bounds acc;
+            int    n = 0;
+            for (int b = nb - 1; b > 0; --b) {
+                acc.Grow(binBox[axis][b]);
+                n += binCount[axis][b];
+                rightArea[b]  = acc.HalfArea();
+                rightCount[b] = n;
+            }
+            acc = Bounds{};
+            n   = 0;
+            for (int b = 1; b < nb; ++b) {
+                acc.Grow(binBox[axis][b - 1]);
+                n += binCount[axis][b - 1];
+                if (n == 0 || rightCount[b] == 0) continue;
+                float cost = acc.HalfArea() * (float)n + rightArea[b] * (float)rightCount[b];
+                if (cost < bestCost) { bestCost = cost; bestAxis = axis; bestBin = b; }
+            }
+        }
+
+        if (bestAxis < 0) {
+            // Every centroid in one place: SAH has nothing to choose from.
+            return SplitMean(start, end, box);
+        }
+
+        float area     = box.HalfArea();
+        float splitCost = opt.traversalCost +
+                          opt.triangleCost * (area > 0.f ? bestCost / area : (float)count);
+        float leafCost  = opt.triangleCost * (float)count;
+        if (count <= opt.maxLeafSize && leafCost <= splitCost) return -1;
+
+        float axisMin = cmin[bestAxis], axisScale = scale[bestAxis];
+        auto midIt = std::partition(refs.begin() + start, refs.begin() + end,
+                                    [&](const BuildRef& r) {
+                                        return BinOf((&r.centroid.x)[bestAxis], axisMin, axisScale, nb) < bestBin;
+                                    });
+        return (int)(midIt - refs.begin());
+    }
+
+    static int BinOf(float c, float cmin, float scale, int nb) {
+        int b = (int)((c - cmin) * scale);
+        return b < 0 ? 0 : (b >= nb ? nb - 1 : b);
+    }
+};
+
+} // namespace
+
+void BVH::Build(std::vector<Tri>&& inTris, const BVHBuildOptions& options, ECS::JobSystem* jobs) {
+    tris = std::move(inTris);
+    nodes.clear();
+    if (tris.empty()) return;
+    nodes.reserve(tris.size() * 2);
+
+    std::vector<BuildRef> refs(tris.size());
+    for (size_t i = 0; i < tris.size(); ++i) {
+        const Tri& t = tris[i];
+        refs[i].bmin = { fminf(t.a.x, fminf(t.b.x, t.c.x)),
+                         fminf(t.a.y, fminf(t.b.y, t.c.y)),
+                         fminf(t.a.z, fminf(t.b.z, t.c.z)) };
+        refs[i].bmax = { fmaxf(t.a.x, fmaxf(t.b.x, t.c.x)),
+                         fmaxf(t.a.y, fmaxf(t.b.y, t.c.y)),
+                         fmaxf(t.a.z, fmaxf(t.b.z, t.c.z)) };
+        refs[i].centroid = t.centroid;
+        refs[i].tri      = (int)i;
+    }
+
+    BVHBuildOptions opt = options;
+    opt.maxLeafSize = std::max(opt.maxLeafSize, 1);
+    opt.parallelMinTris = std::max(opt.parallelMinTris, 2);
+    Builder builder{ opt, refs, nodes, std::clamp(options.bins, 4, MAX_BINS), jobs };
+    builder.BuildNode(0, (int)refs.size(), 0);
+
+    std::vector<Tri> ordered;
+    ordered.reserve(tris.size());
+    for (const BuildRef& r : refs) ordered.push_back(tris[r.tri]);
+    tris = std::move(ordered);
+}
+
+float BVH::SahCost(const BVHBuildOptions& options) const {
+    if (nodes.empty()) return 0.f;
+    Bounds root;
+    root.Grow(nodes[0].bmin, nodes[0].bmax);
+    float rootArea = root.HalfArea();
+    if (rootArea <= 0.f) return options.triangleCost * (float)tris.size();
+
+    float cost = 0.f;
+    for (const BVHNode& n : nodes) {
+        Bounds b;
+        b.Grow(n.bmin, n.bmax);
+        float weight = b.HalfArea() / rootArea;
+        cost += n.rightChild == -1 ? weight * options.triangleCost * (float)n.triCount
+                                   : weight * options.traversalCost;
+    }
+    return cost;
+}
+
+// ─── Queries ─────────────────────────────────────────────────────────────────
+//
+// Rays and sweeps walk the tree iteratively with an explicit stack, nearer
+// child first: both children get a slab test against the ray (for a sweep,
+// the segment start → end against boxes grown by the radius), the nearer
+// one is descended into and the farther pushed with its entry distance.
+// Anything entered beyond the current best hit — on the way down or when
+// popped — is culled, so once a close hit is found the rest of the tree
+// mostly falls away. The build caps the depth at BVH::MAX_DEPTH, which
+// bounds the stack.
+
+// Ordered front-to-back traversal. `leaf(node)` tests a leaf's triangles
+// and lowers bestT on a hit; subtrees entered past min(bestT, tLimit) are
+// skipped.
+template<typename Leaf>
+static void TraverseOrdered(const BVH& bvh, const detail::SlabRay& ray, float pad, float tLimit,
+                            const float& bestT, BVHQueryStats* stats, Leaf&& leaf) {
+    struct Entry { int node; float t; };
+    Entry stack[BVH::MAX_DEPTH];
+    int   sp = 0;
+
+    const BVHNode* nodes = bvh.nodes.data();
+    if (stats) ++stats->nodes;
+    if (detail::SlabEnter(ray, nodes[0], pad, std::min(bestT, tLimit)) == FLT_MAX) return;
+
+    int idx = 0;
+    for (;;) {
+        const BVHNode& node = nodes[idx];
+        if (node.rightChild == -1) {
+            if (stats) stats->tris += (uint64_t)node.triCount;
+            leaf(node);
+        } else {
+            float limit = std::min(bestT, tLimit);
+            int   a = idx + 1, b = node.rightChild;
+            float ta = detail::SlabEnter(ray, nodes[a], pad, limit);
+            float tb = detail::SlabEnter(ray, nodes[b], pad, limit);
+            if (stats) stats->nodes += 2;
+            if (tb < ta) { std::swap(a, b); std::swap(ta, tb); }
+            if (ta != FLT_MAX) {
+                if (tb != FLT_MAX) stack[sp++] = { b, tb };
+                idx = a;
+                continue;
+            }
+        }
+        // Pop the nearest pending subtree still in front of the best hit.
+        for (;;) {
+            if (sp == 0) return;
+            Entry e = stack[--sp];
+            if (e.t <= std::min(bestT, tLimit)) { idx = e.node; break; }
+        }
+    }
+}
+
+// ─── Public queries ──────────────────────────────────────────────────────────
+
+void BVH::Raycast(Vector3 ro, Vector3 rd, float& bestT, Vector3& bestN,
+                  BVHQueryStats* stats) const {
+    if (nodes.empty()) return;
+    TraverseOrdered(*this, detail::MakeSlabRay(ro, rd), 0.f, FLT_MAX, bestT, stats, [&](const BVHNode& node) {
+        for (int i = node.triStart; i < node.triStart + node.triCount; ++i) {
+            const Tri& tri = tris[i];
+            Vector3 n;
+            float t = detail::RayTriangleMT(ro, rd, tri.a, tri.b, tri.c, n);
+            if (t < bestT) { bestT = t; bestN = n; }
+        }
+    });
+}
+
+// Packet traversal: one stack walk for four rays. Each entry keeps the
+// four entry distances (+inf for lanes that missed the box), so a popped
+// subtree is skipped once every lane's best hit is in front of it, and
+// near / far is decided by the nearest lane. Leaves run Möller-Trumbore
+// for the four rays against one triangle at a time, in the same operation
+// order as RayTriangleMT so each lane matches Raycast exactly.
+#if HOTONES_PHYSICS_SSE
+namespace {
+
+struct PacketRays {
+    __m128 ox, oy, oz, dx, dy, dz, ix, iy, iz;
+};
+
+// Lane-wise entry distance into `node`, clipped to [0, tMax]; +inf where
+// the ray misses.
+inline __m128 PacketEnter(const PacketRays& r, const BVHNode& node, __m128 tMax) {
+    __m128 tx1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bmin.x), r.ox), r.ix);
+    __m128 tx2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bmax.x), r.ox), r.ix);
+    __m128 ty1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bmin.y), r.oy), r.iy);
+    __m128 ty2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bmax.y), r.oy), r.iy);
+    __m128 tz1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bmin.z), r.oz), r.iz);
+    __m128 tz2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bmax.z), r.oz), r.iz);
+    __m128 enter = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx1, tx2), _mm_min_ps(ty1, ty2)),
+                              _mm_max_ps(_mm_min_ps(tz1, tz2), _mm_setzero_ps()));
+    __m128 exit  = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx1, tx2), _mm_max_ps(ty1, ty2)),
+                              _mm_min_ps(_mm_max_ps(tz1, tz2), tMax));
+    __m128 in    = _mm_cmple_ps(enter, exit);
+    return _mm_or_ps(_mm_and_ps(in, enter), _mm_andnot_ps(in, _mm_set1_ps(INFINITY)));
+}
+
+inline float LaneMin(__m128 v) {
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm_cvtss_f32(v);
+}
+
+// Four rays against triangle `tri`: lanes that hit closer than bestT take
+// the new t and the triangle index.
+inline void PacketTriangle(const PacketRays& r, const Tri& tri, int index, __m128& bestT, __m128i& bestTri) {
+    const float EPS = 1e-8f;
+    Vector3 e1 = v3sub(tri.b, tri.a), e2 = v3sub(tri.c, tri.a);
+    const __m128 e1x = _mm_set1_ps(e1.x), e1y = _mm_set1_ps(e1.y), e1z = _mm_set1_ps(e1.z);
+    const __m128 e2x = _mm_set1_ps(e2.x), e2y = _mm_set1_ps(e2.y), e2z = _mm_set1_ps(e2.z);
+
+    __m128 hx = _mm_sub_ps(_mm_mul_ps(r.dy, e2z), _mm_mul_ps(r.dz, e2y));
+    __m128 hy = _mm_sub_ps(_mm_mul_ps(r.dz, e2x), _mm_mul_ps(r.dx, e2z));
+    __m128 hz = _mm_sub_ps(_mm_mul_ps(r.dx, e2y), _mm_mul_ps(r.dy, e2x));
+    __m128 a  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, hx), _mm_mul_ps(e1y, hy)), _mm_mul_ps(e1z, hz));
+    __m128 ok = _mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.f), a), _mm_set1_ps(EPS));
+    if (!_mm_movemask_ps(ok)) return;
+    __m128 f  = _mm_div_ps(_mm_set1_ps(1.f), a);
+
+    __m128 sx = _mm_sub_ps(r.ox, _mm_set1_ps(tri.a.x));
+    __m128 sy = _mm_sub_ps(r.oy, _mm_set1_ps(tri.a.y));
+    __m128 sz = _mm_sub_ps(r.oz, _mm_set1_ps(tri.a.z));
+    __m128 u  = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, hx), _mm_mul_ps(sy, hy)), _mm_mul_ps(sz, hz)));
+    ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(u, _mm_setzero_ps()), _mm_cmple_ps(u, _mm_set1_ps(1.f))));
+
+    __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+    __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+    __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+    __m128 v  = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(r.dx, qx), _mm_mul_ps(r.dy, qy)), _mm_mul_ps(r.dz, qz)));
+    ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(v, _mm_setzero_ps()),
+                                   _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.f))));
+    __m128 t  = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)));
+    ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(t, _mm_set1_ps(1e-6f)), _mm_cmplt_ps(t, bestT)));
+
+    bestT   = _mm_or_ps(_mm_and_ps(ok, t), _mm_andnot_ps(ok, bestT));
+    __m128i m = _mm_castps_si128(ok);
+    bestTri = _mm_or_si128(_mm_and_si128(m, _mm_set1_epi32(index)), _mm_andnot_si128(m, bestTri));
+}
+
+} // namespace
+#endif
+
+void BVH::Raycast4(const Vector3 ro[4], const Vector3 rd[4], float bestT[4], Vector3 bestN[4],
+                   BVHQueryStats* stats) const {
+    if (nodes.empty()) return;
+#if HOTONES_PHYSICS_SSE
+    PacketRays r;
+    detail::SlabRay lane[4];
+    for (int k = 0; k < 4; ++k) lane[k] = detail::MakeSlabRay(ro[k], rd[k]);
+    r.ox = _mm_setr_ps(ro[0].x, ro[1].x, ro[2].x, ro[3].x);
+    r.oy = _mm_setr_ps(ro[0].y, ro[1].y, ro[2].y, ro[3].y);
+    r.oz = _mm_setr_ps(ro[0].z, ro[1].z, ro[2].z, ro[3].z);
+    r.dx = _mm_setr_ps(rd[0].x, rd[1].x, rd[2].x, rd[3].x);
+    r.dy = _mm_setr_ps(rd[0].y, rd[1].y, rd[2].y, rd[3].y);
+    r.dz = _mm_setr_ps(rd[0].z, rd[1].z, rd[2].z, rd[3].z);
+    r.ix = _mm_setr_ps(lane[0].inv.x, lane[1].inv.x, lane[2].inv.x, lane[3].inv.x);
+    r.iy = _mm_setr_ps(lane[0].inv.y, lane[1].inv.y, lane[2].inv.y, lane[3].inv.y);
+    r.iz = _mm_setr_ps(lane[0].inv.z, lane[1].inv.z, lane[2].inv.z, lane[3].inv.z);
+
+    __m128  best    = _mm_loadu_ps(bestT);
+    __m128i bestTri = _mm_set1_epi32(-1);
+
+    struct Entry { __m128 t; int node; };
+    Entry stack[MAX_DEPTH];
+    int   sp = 0;
+
+    if (stats) ++stats->nodes;
+    if (!_mm_movemask_ps(_mm_cmplt_ps(PacketEnter(r, nodes[0], best), _mm_set1_ps(INFINITY)))) return;
+
+    int idx = 0;
+    for (;;) {
+        const BVHNode& node = nodes[idx];
+        if (node.rightChild == -1) {
+            if (stats) stats->tris += (uint64_t)node.triCount;
+            for (int i = node.triStart; i < node.triStart + node.triCount; ++i)
+                PacketTriangle(r, tris[i], i, best, bestTri);
+        } else {
+            int    a  = idx + 1, b = node.rightChild;
+            __m128 ta = PacketEnter(r, nodes[a], best);
+            __m128 tb = PacketEnter(r, nodes[b], best);
+            if (stats) stats->nodes += 2;
+            float  na = LaneMin(ta), nb = LaneMin(tb);
+            if (nb < na) { std::swap(a, b); std::swap(ta, tb); std::swap(na, nb); }
+            if (na != INFINITY) {
+                if (nb != INFINITY) stack[sp++] = { tb, b };
+                idx = a;
+                continue;
+            }
+        }
+        // Pop the nearest pending subtree some lane can still hit in.
+        bool popped = false;
+        while (sp > 0 && !popped) {
+            const Entry& e = stack[--sp];
+            if (_mm_movemask_ps(_mm_cmple_ps(e.t, best))) { idx = e.node; popped = true; }
+        }
+        if (!popped) break;
+    }
+
+    alignas(16) int   hitTri[4];
+    alignas(16) float hitT[4];
+    _mm_store_si128((__m128i*)hitTri, bestTri);
+    _mm_store_ps(hitT, best);
+    for (int k = 0; k < 4; ++k) {
+        if (hitTri[k] < 0) continue;
+        const Tri& tri = tris[hitTri[k]];
+        Vector3 n = v3norm(v3cross(v3sub(tri.b, tri.a), v3sub(tri.c, tri.a)));
+        if (v3dot(n, rd[k]) > 0.f) n = v3scale(n, -1.f);
+        bestT[k] = hitT[k];
+        bestN[k] = n;
+    }
+#else
+    for (int k = 0; k < 4; ++k)
+        if (bestT[k] >= 0.f) Raycast(ro[k], rd[k], bestT[k], bestN[k], stats);
+#endif
+}
+
+void BVH::SweepSphere(Vector3 start, Vector3 end, float radius, float& bestT, Vector3& bestN,
+                      BVHQueryStats* stats) const {
+    if (nodes.empty()) return;
+    // Contacts are only reported up to the end of the segment.
+    const float tLimit = 1.f + 1e-6f;
+    TraverseOrdered(*this, detail::MakeSlabRay(start, v3sub(end, start)), radius, tLimit, bestT, stats,
+                    [&](const BVHNode& node) {
+        for (int i = node.triStart; i < node.triStart + node.triCount; ++i) {
+            const Tri& tri = tris[i];
+            Vector3 n;
+            float t = detail::SweepSphereTriangle(start, end, radius, tri.a, tri.b, tri.c, n);
+            if (t < bestT) { bestT = t; bestN = n; }
+        }
+    });
+}
+
+// Penetration needs every overlapping triangle, so there is no order to
+// exploit: a plain depth-first walk with the same explicit stack.
+void BVH::ResolveSphere(Vector3 center, float radius, Vector3& outPush, bool& didPush,
+                        BVHQueryStats* stats) const {
+    if (nodes.empty()) return;
+    int stack[MAX_DEPTH];
+    int sp  = 0;
+    int idx = 0;
+    for (;;) {
+        const BVHNode& node = nodes[idx];
+        if (stats) ++stats->nodes;
+
+        // Quick AABB cull (expand by radius)
+        if (center.x + radius < node.bmin.x || center.x - radius > node.bmax.x ||
+            center.y + radius < node.bmin.y || center.y - radius > node.bmax.y ||
+            center.z + radius < node.bmin.z || center.z - radius > node.bmax.z) {
+            if (sp == 0) return;
+            idx = stack[--sp];
+            continue;
+        }
+
+        if (node.rightChild == -1) {
+            if (stats) stats->tris += (uint64_t)node.triCount;
+            for (int i = node.triStart; i < node.triStart + node.triCount; ++i)
+                if (detail::SpherePushOut(center, radius, tris[i], outPush)) didPush = true;
+            if (sp == 0) return;
+            idx = stack[--sp];
+            continue;
+        }
+        stack[sp++] = node.rightChild;
+        idx = idx + 1;
+    }
+}
+
+}} // namespace Hotones::Physics
@@ -0,0 +1,482 @@
+// 4-wide triangle BVH: collapse from the binary tree and SIMD query kernels
+// (see Physics/BVH4.hpp).
+//
+// Collapse: every binary internal node becomes a wide node whose children
+// are found by repeatedly opening the largest (by surface area) child that
+// is still internal, until there are four. Subtrees of at most four
+// triangles end the descent and become one packet, so wide leaves fill
+// their lanes even when the builder made small binary leaves.
+//
+// Queries mirror BVH.cpp: rays and sweeps are ordered front to back with
+// culling against the best hit, penetration visits every overlapping leaf.
+// A wide node pushes its hit children far-to-near, so the nearest is popped
+// next; leaves sit on the same stack and are tested when popped. Sweep and
+// penetration leaves first test the four triangle boxes like child boxes
+// and run the exact kernel on the lanes that pass.
+
+#include <Physics/BVH4.hpp>
+#include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <cmath>
+#include <raymath.h>
+
+namespace Hotones { namespace Physics {
+
+// ─── Collapse ────────────────────────────────────────────────────────────────
+
+namespace {
+
+constexpr int PACKET_TRIS = 4;
+
+struct Collapser {
+    const std::vector<BVHNode>& bin;
+    const std::vector<Tri>&     tris;
+    std::vector<BVH4Node>&      nodes;
+    std::vector<TriPacket4>&    packets;
+    std::vector<int>            first, last;   // triangle range of each binary subtree
+
+    // Internal binary nodes store no range; children always follow their
+    // parent, so one backwards pass fills them in.
+    void ComputeRanges() {
+        first.resize(bin.size());
+        last.resize(bin.size());
+        for (int i = (int)bin.size() - 1; i >= 0; --i) {
+            if (bin[i].rightChild == -1) {
+                first[i] = bin[i].triStart;
+                last[i]  = bin[i].triStart + bin[i].triCount;
+            } else {
+                first[i] = first[i + 1];
+                last[i]  = last[bin[i].rightChild];
+            }
+        }
+    }
+
+    bool EndsDescent(int i) const {
+        return bin[i].rightChild == -1 || last[i] - first[i] <= PACKET_TRIS;
+    }
+
+    static float HalfArea(const BVHNode& n) {
+        float x = n.bmax.x - n.bmin.x, y = n.bmax.y - n.bmin.y, z = n.bmax.z - n.bmin.z;
+        return x * y + y * z + z * x;
+    }
+
+    // Pack triangles [start, end) four at a time; returns the first packet.
+    int EmitPackets(int start, int end) {
+        int firstPacket = (int)packets.size();
+        for (int i = start; i < end; i += PACKET_TRIS) {
+            TriPacket4 p{};
+            for (int k = 0; k < PACKET_TRIS; ++k) {
+                p.tri[k] = -1;
+                if (i + k >= end) continue;       // padding: degenerate, never hit
+                const Tri& t = tris[i + k];
+                p.a[0][k] = t.a.x; p.a[1][k] = t.a.y; p.a[2][k] = t.a.z;
+                p.b[0][k] = t.b.x; p.b[1][k] = t.b.y; p.b[2][k] = t.b.z;
+                p.c[0][k] = t.c.x; p.c[1][k] = t.c.y; p.c[2][k] = t.c.z;
+                p.tri[k] = i + k;
+            }
+            packets.push_back(p);
+        }
+        return firstPacket;
+    }
+
+    static BVH4Node EmptyNode() {
+        BVH4Node n;
+        for (int k = 0; k < 4; ++k) {
+            n.bminX[k] = n.bminY[k] = n.bminZ[k] =  FLT_MAX;
+            n.bmaxX[k] = n.bmaxY[k] = n.bmaxZ[k] = -FLT_MAX;
+            n.child[k] = -1;
+            n.count[k] = 0;
+        }
+        return n;
+    }
+
+    // Fill lane k of wide node `idx` with binary subtree `b`.
+    void SetLane(int idx, int k, int b) {
+        const BVHNode& src = bin[b];
+        int child = 0, count = 0;
+        if (EndsDescent(b)) {
+            child = EmitPackets(first[b], last[b]);
+            count = (last[b] - first[b] + PACKET_TRIS - 1) / PACKET_TRIS;
+        } else {
+            child = EmitNode(b);
+        }
+        BVH4Node& n = nodes[idx];                 // after EmitNode: nodes may have grown
+        n.bminX[k] = src.bmin.x; n.bminY[k] = src.bmin.y; n.bminZ[k] = src.bmin.z;
+        n.bmaxX[k] = src.bmax.x; n.bmaxY[k] = src.bmax.y; n.bmaxZ[k] = src.bmax.z;
+        n.child[k] = child;
+        n.count[k] = count;
+    }
+
+    // Wide node for binary internal node `b`; returns its index.
+    int EmitNode(int b) {
+        int slots[4] = { b + 1, bin[b].rightChild, -1, -1 };
+        int n = 2;
+        while (n < 4) {
+            int   open = -1;
+            float openArea = -1.f;
+            for (int k = 0; k < n; ++k) {
+                if (EndsDescent(slots[k])) continue;
+                float area = HalfArea(bin[slots[k]]);
+                if (area > openArea) { openArea = area; open = k; }
+            }
+            if (open < 0) break;
+            int opened  = slots[open];
+            slots[open] = opened + 1;
+            slots[n++]  = bin[opened].rightChild;
+        }
+
+        int idx = (int)nodes.size();
+        nodes.push_back(EmptyNode());
+        for (int k = 0; k < n; ++k) SetLane(idx, k, slots[k]);
+        return idx;
+    }
+};
+
+} // namespace
+
+void BVH4::Collapse(BVH&& binary) {
+    nodes.clear();
+    packets.clear();
+    tris = std::move(binary.tris);
+    std::vector<BVHNode> bin = std::move(binary.nodes);
+    binary.nodes.clear();
+    binary.tris.clear();
+    if (bin.empty()) return;
+
+    nodes.reserve(bin.size() / 2 + 1);
+    packets.reserve(tris.size() / 2 + 1);
+    Collapser c{ bin, tris, nodes, packets, {}, {} };
+    c.ComputeRanges();
+    if (c.EndsDescent(0)) {
+        // A mesh small enough for one leaf still gets a root node to hold it.
+        nodes.push_back(Collapser::EmptyNode());
+        c.SetLane(0, 0, 0);
+    } else {
+        c.EmitNode(0);
+    }
+}
+
+// ─── Kernels ─────────────────────────────────────────────────────────────────
+//
+// Each has an SSE body and a per-lane scalar fallback computing the same
+// expressions in the same order, so results do not depend on the target.
+
+namespace {
+
+// Query segment prepared for the slab tests: the box planes are compared
+// against the origin shifted by ∓pad instead of growing every box.
+struct WideRay {
+    Vector3 lo, hi, inv;      // o + pad, o - pad, per-axis 1 / d
+#if HOTONES_PHYSICS_SSE
+    __m128  loX, loY, loZ, hiX, hiY, hiZ, invX, invY, invZ;
+#endif
+};
+
+WideRay MakeWideRay(Vector3 o, Vector3 d, float pad) {
+    // Zero components get a huge finite inverse, as in BVH.cpp.
+    auto inv = [](float v) { return std::fabs(v) > 1e-20f ? 1.f / v : (v < 0.f ? -1e30f : 1e30f); };
+    WideRay r;
+    r.lo  = { o.x + pad, o.y + pad, o.z + pad };
+    r.hi  = { o.x - pad, o.y - pad, o.z - pad };
+    r.inv = { inv(d.x), inv(d.y), inv(d.z) };
+#if HOTONES_PHYSICS_SSE
+    r.loX  = _mm_set1_ps(r.lo.x);  r.loY  = _mm_set1_ps(r.lo.y);  r.loZ  = _mm_set1_ps(r.lo.z);
+    r.hiX  = _mm_set1_ps(r.hi.x);  r.hiY  = _mm_set1_ps(r.hi.y);  r.hiZ  = _mm_set1_ps(r.hi.z);
+    r.invX = _mm_set1_ps(r.inv.x); r.invY = _mm_set1_ps(r.inv.y); r.invZ = _mm_set1_ps(r.inv.z);
+#endif
+    return r;
+}
+
+// Lanes whose index is not -1 (used children, real triangles).
+inline int UsedLanes(const int32_t index[4]) {
+#if HOTONES_PHYSICS_SSE
+    return ~_mm_movemask_ps(_mm_castsi128_ps(_mm_load_si128((const __m128i*)index))) & 0xF;
+#else
+    return (index[0] >= 0) | (index[1] >= 0) << 1 | (index[2] >= 0) << 2 | (index[3] >= 0) << 3;
+#endif
+}
+
+// Four boxes, lane by lane: a node's children or a packet's triangles.
+struct Box4 {
+#if HOTONES_PHYSICS_SSE
+    __m128 minX, minY, minZ, maxX, maxY, maxZ;
+#else
+    float  minX[4], minY[4], minZ[4], maxX[4], maxY[4], maxZ[4];
+#endif
+};
+
+inline Box4 ChildBoxes(const BVH4Node& n) {
+#if HOTONES_PHYSICS_SSE
+    return { _mm_load_ps(n.bminX), _mm_load_ps(n.bminY), _mm_load_ps(n.bminZ),
+             _mm_load_ps(n.bmaxX), _mm_load_ps(n.bmaxY), _mm_load_ps(n.bmaxZ) };
+#else
+    Box4 b;
+    for (int k = 0; k < 4; ++k) {
+        b.minX[k] = n.bminX[k]; b.minY[k] = n.bminY[k]; b.minZ[k] = n.bminZ[k];
+        b.maxX[k] = n.bmaxX[k]; b.maxY[k] = n.bmaxY[k]; b.maxZ[k] = n.bmaxZ[k];
+    }
+    return b;
+#endif
+}
+
+inline Box4 TriangleBoxes(const TriPacket4& p) {
+#if HOTONES_PHYSICS_SSE
+    Box4 b;
+    __m128 ax = _mm_load_ps(p.a[0]), bx = _mm_load_ps(p.b[0]), cx = _mm_load_ps(p.c[0]);
+    __m128 ay = _mm_load_ps(p.a[1]), by = _mm_load_ps(p.b[1]), cy = _mm_load_ps(p.c[1]);
+    __m128 az = _mm_load_ps(p.a[2]), bz = _mm_load_ps(p.b[2]), cz = _mm_load_ps(p.c[2]);
+    b.minX = _mm_min_ps(ax, _mm_min_ps(bx, cx)); b.maxX = _mm_max_ps(ax, _mm_max_ps(bx, cx));
+    b.minY = _mm_min_ps(ay, _mm_min_ps(by, cy)); b.maxY = _mm_max_ps(ay, _mm_max_ps(by, cy));
+    b.minZ = _mm_min_ps(az, _mm_min_ps(bz, cz)); b.maxZ = _mm_max_ps(az, _mm_max_ps(bz, cz));
+    return b;
+#else
+    Box4 b;
+    for (int k = 0; k < 4; ++k) {
+        b.minX[k] = std::min(p.a[0][k], std::min(p.b[0][k], p.c[0][k]));
+        b.minY[k] = std::min(p.a[1][k], std::min(p.b[1][k], p.c[1][k]));
+        b.minZ[k] = std::min(p.a[2][k], std::min(p.b[2][k], p.c[2][k]));
+        b.maxX[k] = std::max(p.a[0][k], std::max(p.b[0][k], p.c[0][k]));
+        b.maxY[k] = std::max(p.a[1][k], std::max(p.b[1][k], p.c[1][k]));
+        b.maxZ[k] = std::max(p.a[2][k], std::max(p.b[2][k], p.c[2][k]));
+    }
+    return b;
+#endif
+}
+
+// Entry distances of the ray into the four boxes, clipped to [0, tMax],
+// written to tEnter; returns the lanes it enters.
+inline int SlabMask(const Box4& b, const WideRay& r, float tMax, float tEnter[4]) {
+#if HOTONES_PHYSICS_SSE
+    __m128 tx1 = _mm_mul_ps(_mm_sub_ps(b.minX, r.loX), r.invX), tx2 = _mm_mul_ps(_mm_sub_ps(b.maxX, r.hiX), r.invX);
+    __m128 ty1 = _mm_mul_ps(_mm_sub_ps(b.minY, r.loY), r.invY), ty2 = _mm_mul_ps(_mm_sub_ps(b.maxY, r.hiY), r.invY);
+    __m128 tz1 = _mm_mul_ps(_mm_sub_ps(b.minZ, r.loZ), r.invZ), tz2 = _mm_mul_ps(_mm_sub_ps(b.maxZ, r.hiZ), r.invZ);
+    __m128 enter = _mm_max_ps(_mm_max_ps(_mm_min_ps(tx1, tx2), _mm_min_ps(ty1, ty2)),
+                              _mm_max_ps(_mm_min_ps(tz1, tz2), _mm_setzero_ps()));
+    __m128 exit  = _mm_min_ps(_mm_min_ps(_mm_max_ps(tx1, tx2), _mm_max_ps(ty1, ty2)),
+                              _mm_min_ps(_mm_max_ps(tz1, tz2), _mm_set1_ps(tMax)));
+    _mm_storeu_ps(tEnter, enter);
+    return _mm_movemask_ps(_mm_cmple_ps(enter, exit));
+#else
+    int mask = 0;
+    for (int k = 0; k < 4; ++k) {
+        float tx1 = (b.minX[k] - r.lo.x) * r.inv.x, tx2 = (b.maxX[k] - r.hi.x) * r.inv.x;
+        float ty1 = (b.minY[k] - r.lo.y) * r.inv.y, ty2 = (b.maxY[k] - r.hi.y) * r.inv.y;
+        float tz1 = (b.minZ[k] - r.lo.z) * r.inv.z, tz2 = (b.maxZ[k] - r.hi.z) * r.inv.z;
+        float enter = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::max(std::min(tz1, tz2), 0.f));
+        float exit  = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::min(std::max(tz1, tz2), tMax));
+        tEnter[k] = enter;
+        mask |= (enter <= exit) << k;
+    }
+    return mask;
+#endif
+}
+
+// Lanes whose box, grown by r, contains c.
+inline int SphereMask(const Box4& b, Vector3 c, float r) {
+#if HOTONES_PHYSICS_SSE
+    __m128 in = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(_mm_set1_ps(c.x + r), b.minX),
+                                      _mm_cmple_ps(_mm_set1_ps(c.x - r), b.maxX)),
+                           _mm_and_ps(_mm_cmpge_ps(_mm_set1_ps(c.y + r), b.minY),
+                                      _mm_cmple_ps(_mm_set1_ps(c.y - r), b.maxY)));
+    in = _mm_and_ps(in, _mm_and_ps(_mm_cmpge_ps(_mm_set1_ps(c.z + r), b.minZ),
+                                   _mm_cmple_ps(_mm_set1_ps(c.z - r), b.maxZ)));
+    return _mm_movemask_ps(in);
+#else
+    int mask = 0;
+    for (int k = 0; k < 4; ++k)
+        mask |= (c.x + r >= b.minX[k] && c.x - r <= b.maxX[k] &&
+                 c.y + r >= b.minY[k] && c.y - r <= b.maxY[k] &&
+                 c.z + r >= b.minZ[k] && c.z - r <= b.maxZ[k]) << k;
+    return mask;
+#endif
+}
+
+// Möller-Trumbore on the four lanes of a packet, as detail::RayTriangleMT
+// does for one. On a hit closer than bestT, lowers it and records the
+// triangle; the normal is left to the caller.
+inline void RayPacket(const TriPacket4& p, Vector3 ro, Vector3 rd, float& bestT, int& bestTri) {
+    const float EPS = 1e-8f;
+#if HOTONES_PHYSICS_SSE
+    const __m128 dx = _mm_set1_ps(rd.x), dy = _mm_set1_ps(rd.y), dz = _mm_set1_ps(rd.z);
+    const __m128 ax = _mm_load_ps(p.a[0]), ay = _mm_load_ps(p.a[1]), az = _mm_load_ps(p.a[2]);
+    const __m128 e1x = _mm_sub_ps(_mm_load_ps(p.b[0]), ax), e2x = _mm_sub_ps(_mm_load_ps(p.c[0]), ax);
+    const __m128 e1y = _mm_sub_ps(_mm_load_ps(p.b[1]), ay), e2y = _mm_sub_ps(_mm_load_ps(p.c[1]), ay);
+    const __m128 e1z = _mm_sub_ps(_mm_load_ps(p.b[2]), az), e2z = _mm_sub_ps(_mm_load_ps(p.c[2]), az);
+
+    // h = d × e2, a = e1 · h
+    __m128 hx = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+    __m128 hy = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+    __m128 hz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+    __m128 a  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, hx), _mm_mul_ps(e1y, hy)), _mm_mul_ps(e1z, hz));
+    __m128 ok = _mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.f), a), _mm_set1_ps(EPS));
+    if (!_mm_movemask_ps(ok)) return;
+    __m128 f  = _mm_div_ps(_mm_set1_ps(1.f), a);
+
+    // s = o - a, u = f (s · h)
+    __m128 sx = _mm_sub_ps(_mm_set1_ps(ro.x), ax);
+    __m128 sy = _mm_sub_ps(_mm_set1_ps(ro.y), ay);
+    __m128 sz = _mm_sub_ps(_mm_set1_ps(ro.z), az);
+    __m128 u  = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, hx), _mm_mul_ps(sy, hy)), _mm_mul_ps(sz, hz)));
+    ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(u, _mm_setzero_ps()), _mm_cmple_ps(u, _mm_set1_ps(1.f))));
+
+    // q = s × e1, v = f (d · q), t = f (e2 · q)
+    __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+    __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+    __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+    __m128 v  = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)));
+    ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(v, _mm_setzero_ps()),
+                                   _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.f))));
+    __m128 t  = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)));
+    ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(t, _mm_set1_ps(1e-6f)), _mm_cmplt_ps(t, _mm_set1_ps(bestT))));
+
+    int hits = _mm_movemask_ps(ok);
+    if (!hits) return;
+    alignas(16) float ts[4];
+    _mm_store_ps(ts, t);
+    for (; hits; hits &= hits - 1) {
+        int k = std::countr_zero((unsigned)hits);
+        if (ts[k] < bestT) { bestT = ts[k]; bestTri = p.tri[k]; }
+    }
+#else
+    for (int k = 0; k < 4; ++k) {
+        if (p.tri[k] < 0) continue;
+        Vector3 ta = { p.a[0][k], p.a[1][k], p.a[2][k] };
+        Vector3 e1 = Vector3Subtract({ p.b[0][k], p.b[1][k], p.b[2][k] }, ta);
+        Vector3 e2 = Vector3Subtract({ p.c[0][k], p.c[1][k], p.c[2][k] }, ta);
+        Vector3 h  = Vector3CrossProduct(rd, e2);
+        float   a  = Vector3DotProduct(e1, h);
+        if (std::fabs(a) < EPS) continue;
+        float   f  = 1.f / a;
+        Vector3 s  = Vector3Subtract(ro, ta);
+        float   u  = f * Vector3DotProduct(s, h);
+        if (u < 0.f || u > 1.f) continue;
+        Vector3 q  = Vector3CrossProduct(s, e1);
+        float   v  = f * Vector3DotProduct(rd, q);
+        if (v < 0.f || u + v > 1.f) continue;
+        float   t  = f * Vector3DotProduct(e2, q);
+        if (t >= 1e-6f && t < bestT) { bestT = t; bestTri = p.tri[k]; }
+    }
+#endif
+}
+
+// Ordered front-to-back traversal, as TraverseOrdered in BVH.cpp.
+// `leaf(firstPacket, packetCount)` tests a leaf and lowers bestT on a hit.
+template<typename Leaf>
+void TraverseOrdered4(const BVH4& bvh, const WideRay& ray, float tLimit, const float& bestT,
+                      BVHQueryStats* stats, Leaf&& leaf) {
+    struct Entry { int child, count; float t; };
+    Entry stack[BVH4::STACK_SIZE];
+    int   sp   = 0;
+    int   node = 0;
+    for (;;) {
+        const BVH4Node& n = bvh.nodes[node];
+        const int used = UsedLanes(n.child);
+        alignas(16) float t[4];
+        int hits = SlabMask(ChildBoxes(n), ray, std::min(bestT, tLimit), t) & used;
+        if (stats) stats->nodes += (uint64_t)std::popcount((unsigned)used);
+
+        // Near-to-far order of the lanes entered, then push far-to-near.
+        int order[4], k = 0;
+        for (; hits; hits &= hits - 1) {
+            int lane = std::countr_zero((unsigned)hits), j = k++;
+            for (; j > 0 && t[order[j - 1]] > t[lane]; --j) order[j] = order[j - 1];
+            order[j] = lane;
+        }
+        while (k > 0) {
+            int lane = order[--k];
+            stack[sp++] = { n.child[lane], n.count[lane], t[lane] };
+        }
+
+        // Pop the nearest pending child still in front of the best hit;
+        // leaves are tested here, nodes break out to be expanded.
+        for (;;) {
+            if (sp == 0) return;
+            Entry e = stack[--sp];
+            if (e.t > std::min(bestT, tLimit)) continue;
+            if (e.count == 0) { node = e.child; break; }
+            if (stats)
+                for (int p = e.child; p < e.child + e.count; ++p)
+                    stats->tris += (uint64_t)std::popcount((unsigned)UsedLanes(bvh.packets[p].tri));
+            leaf(e.child, e.count);
+        }
+    }
+}
+
+} // namespace
+
+// ─── Public queries ──────────────────────────────────────────────────────────
+
+void BVH4::Raycast(Vector3 ro, Vector3 rd, float& bestT, Vector3& bestN,
+                   BVHQueryStats* stats) const {
+    if (nodes.empty()) return;
+    int hitTri = -1;
+    TraverseOrdered4(*this, MakeWideRay(ro, rd, 0.f), FLT_MAX, bestT, stats, [&](int first, int count) {
+        for (int p = first; p < first + count; ++p) RayPacket(packets[p], ro, rd, bestT, hitTri);
+    });
+    if (hitTri < 0) return;
+
+    // Face normal toward the ray, as detail::RayTriangleMT reports it.
+    const Tri& tri = tris[hitTri];
+    Vector3 n = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(tri.b, tri.a),
+                                                     Vector3Subtract(tri.c, tri.a)));
+    if (Vector3DotProduct(n, rd) > 0.f) n = Vector3Scale(n, -1.f);
+    bestN = n;
+}
+
+void BVH4::Raycast4(const Vector3 ro[4], const Vector3 rd[4], float bestT[4], Vector3 bestN[4],
+                    BVHQueryStats* stats) const {
+    for (int k = 0; k < 4; ++k)
+        if (bestT[k] >= 0.f) Raycast(ro[k], rd[k], bestT[k], bestN[k], stats);
+}
+
+void BVH4::SweepSphere(Vector3 start, Vector3 end, float radius, float& bestT, Vector3& bestN,
+                       BVHQueryStats* stats) const {
+    if (nodes.empty()) return;
+    const float   tLimit = 1.f + 1e-6f;
+    const WideRay ray    = MakeWideRay(start, Vector3Subtract(end, start), radius);
+    TraverseOrdered4(*this, ray, tLimit, bestT, stats, [&](int first, int count) {
+        for (int p = first; p < first + count; ++p) {
+            const TriPacket4& packet = packets[p];
+            alignas(16) float t[4];
+            int lanes = SlabMask(TriangleBoxes(packet), ray, std::min(bestT, tLimit), t) & UsedLanes(packet.tri);
+            for (; lanes; lanes &= lanes - 1) {
+                const Tri& tri = tris[packet.tri[std::countr_zero((unsigned)lanes)]];
+                Vector3 n;
+                float tHit = detail::SweepSphereTriangle(start, end, radius, tri.a, tri.b, tri.c, n);
+                if (tHit < bestT) { bestT = tHit; bestN = n; }
+            }
+        }
+    });
+}
+
+void BVH4::ResolveSphere(Vector3 center, float radius, Vector3& outPush, bool& didPush,
+                         BVHQueryStats* stats) const {
+    if (nodes.empty()) return;
+    int stack[STACK_SIZE];
+    int sp = 0;
+    int node = 0;
+    for (;;) {
+        const BVH4Node& n = nodes[node];
+        const int used = UsedLanes(n.child);
+        if (stats) stats->nodes += (uint64_t)std::popcount((unsigned)used);
+        for (int hits = SphereMask(ChildBoxes(n), center, radius) & used; hits; hits &= hits - 1) {
+            int lane = std::countr_zero((unsigned)hits);
+            if (n.count[lane] == 0) { stack[sp++] = n.child[lane]; continue; }
+            for (int p = n.child[lane]; p < n.child[lane] + n.count[lane]; ++p) {
+                const TriPacket4& packet = packets[p];
+                const int real = UsedLanes(packet.tri);
+                if (stats) stats->tris += (uint64_t)std::popcount((unsigned)real);
+                for (int lanes = SphereMask(TriangleBoxes(packet), center, radius) & real; lanes;
+                     lanes &= lanes - 1) {
+                    const Tri& tri = tris[packet.tri[std::countr_zero((unsigned)lanes)]];
+                    if (detail::SpherePushOut(center, radius, tri, outPush)) didPush = true;
+                }
+            }
+        }
+        if (sp == 0) return;
+        node = stack[--sp];
+    }
+}
+
+}} // namespace Hotones::Physics
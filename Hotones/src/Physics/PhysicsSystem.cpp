@@ -1,420 +1,479 @@
 // Physics backend: triangle-accurate sphere sweeps via a mid-phase BVH.
 //
 // Design:
-//   BuildBVH()              — recursive median-split BVH over triangles
-//   SweepSphereNode()       — traverse BVH, run analytic sphere-vs-tri test per leaf
-//   PenetrationSphereNode() — traverse BVH, resolve sphere-vs-tri overlap
-//
-// Sphere-vs-triangle sweep:
-//   We cast a ray from (start) to (end) against the "inflated" geometry of each
-//   triangle (the Minkowski sum of the triangle with a sphere of the given radius).
-//   That Minkowski sum consists of:
-//     1. The triangle face (ray vs plane, clamped to triangle)
-//     2. Three edge capsules (ray vs infinite cylinder for each edge)
-//     3. Three vertex spheres
-//   We return the earliest parametric hit t ∈ [0,1].
+//   Physics/BVH.cpp          — BVH builders (mean split / binned SAH) and the
+//                              ray, sphere-sweep and penetration kernels
+//   Physics/BVH4.cpp         — the same queries on the tree collapsed to
+//                              four-wide nodes (BVHLayout::Wide4), SIMD
+//   this file                — static mesh registry, background BVH builds on
+//                              a worker pool, handle-based query entry points,
+//                              a world-level tree over every mesh for world
+//                              queries, and batched (sorted, packetised) raycasts
 
 #include "../include/Physics/PhysicsSystem.hpp"
+#include <Physics/BVH.hpp>
+#include <Physics/BVH4.hpp>
+#include <ECS/JobSystem.hpp>
 #include <algorithm>
+#include <chrono>
 #include <cfloat>
 #include <cstring>
 #include <iostream>
 #include <raylib.h>
 #include <memory>
-#include <thread>
 #include <condition_variable>
 #include <atomic>
-#include <deque>
 #include <mutex>
 #include <vector>
 #include <raymath.h>
 
 // ─── Geometry helpers (file-internal) ────────────────────────────────────────
 
-static inline float v3dot(Vector3 a, Vector3 b) { return Vector3DotProduct(a, b); }
-static inline float v3len(Vector3 a)             { return Vector3Length(a); }
-static inline Vector3 v3norm(Vector3 a)           { return Vector3Normalize(a); }
 static inline Vector3 v3sub(Vector3 a, Vector3 b) { return Vector3Subtract(a, b); }
 static inline Vector3 v3add(Vector3 a, Vector3 b) { return Vector3Add(a, b); }
 static inline Vector3 v3scale(Vector3 a, float s) { return Vector3Scale(a, s); }
-static inline Vector3 v3cross(Vector3 a, Vector3 b){ return Vector3CrossProduct(a, b); }
-
-// Closest point on triangle (abc) to point p — Ericson §5.1.5
-static Vector3 ClosestPtTriangle(Vector3 p, Vector3 a, Vector3 b, Vector3 c) {
-    Vector3 ab = v3sub(b,a), ac = v3sub(c,a), ap = v3sub(p,a);
-    float d1 = v3dot(ab,ap), d2 = v3dot(ac,ap);
-    if (d1 <= 0.f && d2 <= 0.f) return a;
-
-    Vector3 bp = v3sub(p,b);
-    float d3 = v3dot(ab,bp), d4 = v3dot(ac,bp);
-    if (d3 >= 0.f && d4 <= d3) return b;
-
-    float vc = d1*d4 - d3*d2;
-    if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
-        float v = d1 / (d1 - d3);
-        return v3add(a, v3scale(ab, v));
-    }
+static inline Vector3 v3min(Vector3 a, Vector3 b)   { return { std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z) }; }
+static inline Vector3 v3max(Vector3 a, Vector3 b)   { return { std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z) }; }
 
-    Vector3 cp = v3sub(p,c);
-    float d5 = v3dot(ab,cp), d6 = v3dot(ac,cp);
-    if (d6 >= 0.f && d5 <= d6) return c;
+using Hotones::Physics::BVH;
+using Hotones::Physics::BVH4;
+using Hotones::Physics::BVHNode;
+using Hotones::Physics::Tri;
 
-    float vb = d5*d2 - d1*d6;
-    if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
-        float w = d2 / (d2 - d6);
-        return v3add(a, v3scale(ac, w));
-    }
+// ─── Static mesh registry ─────────────────────────────────────────────────────
 
-    float va = d3*d6 - d5*d4;
-    float denom = d4 - d3 + d5 - d6;
-    if (va <= 0.f && denom > 0.f) {
-        float w = (d4 - d3) / denom;
-        return v3add(b, v3scale(v3sub(c,b), w));
-    }
+// A mesh's BVH is published once, fully built, in the layout its build
+// options asked for; queries take their own reference so a concurrent
+// unregister cannot free it mid-traversal.
+struct StaticMeshEntry {
+    int                         handle = 0;
+    std::shared_ptr<const BVH>  bvh;       // BVHLayout::Binary, null until built
+    std::shared_ptr<const BVH4> bvh4;      // BVHLayout::Wide4, null until built
+    Vector3                     bmin = { 0, 0, 0 }, bmax = { 0, 0, 0 };  // once built
+
+    bool Built() const { return bvh || bvh4; }
+    // Built with at least one triangle.
+    bool Queryable() const { return (bvh4 && !bvh4->Empty()) || (bvh && !bvh->nodes.empty()); }
+};
 
-    float dv = 1.f / (va + vb + vc);
-    float vv = vb * dv, wv = vc * dv;
-    return v3add(a, v3add(v3scale(ab,vv), v3scale(ac,wv)));
-}
-
-// Analytic ray-vs-sphere: ray o+t*d, sphere center c radius r.
-// Returns t of first intersection, or FLT_MAX if none in [tMin,tMax].
-static float RaySphere(Vector3 o, Vector3 d, Vector3 c, float r, float tMin, float tMax) {
-    Vector3 oc = v3sub(o, c);
-    float A = v3dot(d,d);
-    float B = 2.f * v3dot(oc, d);
-    float C = v3dot(oc, oc) - r*r;
-    float disc = B*B - 4.f*A*C;
-    if (disc < 0.f) return FLT_MAX;
-    float sqrtD = sqrtf(disc);
-    float t = (-B - sqrtD) / (2.f*A);
-    if (t >= tMin && t <= tMax) return t;
-    t = (-B + sqrtD) / (2.f*A);
-    if (t >= tMin && t <= tMax) return t;
-    return FLT_MAX;
-}
-
-// Analytic ray-vs-infinite-cylinder (axis a→b, radius r).
-// Returns t of first lateral intersection, or FLT_MAX if none.
-static float RayCylinder(Vector3 ro, Vector3 rd, Vector3 a, Vector3 b, float r, float tMin, float tMax) {
-    Vector3 ab  = v3sub(b, a);
-    Vector3 ao  = v3sub(ro, a);
-    float abLen2 = v3dot(ab, ab);
-    if (abLen2 < 1e-10f) return FLT_MAX;
-
-    // Project rd and ao onto plane perpendicular to ab
-    float rdDotAb = v3dot(rd, ab) / abLen2;
-    float aoDotAb = v3dot(ao, ab) / abLen2;
-    Vector3 d_perp = v3sub(rd, v3scale(ab, rdDotAb));
-    Vector3 o_perp = v3sub(ao, v3scale(ab, aoDotAb));
-
-    float A = v3dot(d_perp, d_perp);
-    float B = 2.f * v3dot(o_perp, d_perp);
-    float C = v3dot(o_perp, o_perp) - r*r;
-    float disc = B*B - 4.f*A*C;
-    if (disc < 0.f || A < 1e-10f) return FLT_MAX;
-    float sqrtD = sqrtf(disc);
-    float t = (-B - sqrtD) / (2.f*A);
-    if (t < tMin || t > tMax) {
-        t = (-B + sqrtD) / (2.f*A);
-        if (t < tMin || t > tMax) return FLT_MAX;
+// Top level over the bounds of every queryable mesh, for queries against
+// the whole world: a BVHNode tree whose leaves hold one mesh each
+// (triStart indexes `meshes`), split at the median along the widest axis
+// of the mesh centres. Rebuilt and republished whole whenever a mesh is
+// published or unregistered; queries hold a reference, like they do to a
+// mesh BVH. Static meshes never move, so there is nothing to refit, and a
+// rebuild over a few hundred boxes is cheap enough to run under the lock.
+struct WorldTree {
+    std::vector<StaticMeshEntry> meshes;
+    std::vector<BVHNode>         nodes;    // nodes[0] is the root
+};
+
+static std::vector<StaticMeshEntry> g_staticMeshes;
+static int                          g_nextHandle = 1;
+static int                          g_pendingBuilds = 0;
+static Hotones::Physics::BVHBuildOptions g_buildOptions;
+static std::shared_ptr<const WorldTree>  g_world;
+static std::mutex                   g_meshMutex;     // guards everything above
+static std::condition_variable      g_buildDoneCv;   // a build finished or was dropped
+
+// Background BVH builds: one job per registered mesh on a pool owned by the
+// physics system (not the ECS frame pool, so long builds never hold up a
+// frame). Large meshes fan their top levels out over the same pool.
+// g_buildJobs is only touched under g_jobsMutex; callers take a reference
+// and jobs get the raw pointer at submit time, so ShutdownPhysics dropping
+// the pool never pulls it from under a build or a waiter.
+static std::shared_ptr<Hotones::ECS::JobSystem> g_buildJobs;
+static std::mutex                               g_jobsMutex;
+static Hotones::ECS::JobSystem::Counter         g_buildCounter;
+static std::atomic<bool>                        g_cancelBuilds{false};
+
+// The build pool, started on first use with `workers` threads (0: default).
+static std::shared_ptr<Hotones::ECS::JobSystem> AcquireBuildJobs(unsigned workers) {
+    std::lock_guard<std::mutex> lk(g_jobsMutex);
+    if (!g_buildJobs) {
+        if (!workers) workers = Hotones::ECS::JobSystem::DefaultWorkerCount();
+        g_buildJobs = std::make_shared<Hotones::ECS::JobSystem>(workers);
+        TraceLog(LOG_INFO, "[Physics] %u BVH build worker(s) started", g_buildJobs->WorkerCount());
     }
-    // Check that the hit lies between a and b along the cylinder axis
-    Vector3 hitPt = v3add(ro, v3scale(rd, t));
-    float proj = v3dot(v3sub(hitPt, a), ab) / abLen2;
-    if (proj < 0.f || proj > 1.f) return FLT_MAX;
-    return t;
-}
-
-// Continuous sphere vs triangle sweep.
-// Returns t ∈ [0, segLen/segLen=1] of first contact, FLT_MAX if no hit.
-// outNormal filled with the contact normal at impact.
-static float SweepSphereTriangle(Vector3 start, Vector3 end, float radius,
-                                  Vector3 ta, Vector3 tb, Vector3 tc,
-                                  Vector3& outNormal) {
-    Vector3 d    = v3sub(end, start);
-    float segLen = v3len(d);
-    if (segLen < 1e-10f) return FLT_MAX;
-
-    Vector3 triNorm = v3norm(v3cross(v3sub(tb,ta), v3sub(tc,ta)));
-    float bestT = FLT_MAX;
-    Vector3 bestN = triNorm;
+    return g_buildJobs;
+}
 
-    // ── 1. Ray vs face (inflated by radius along normal) ─────────────────────
-    {
-        float nDotD = v3dot(triNorm, d);
-        if (fabsf(nDotD) > 1e-8f) {
-            // Inflate plane by radius toward sphere origin
-            for (int sign = -1; sign <= 1; sign += 2) {
-                Vector3 planePoint = v3add(ta, v3scale(triNorm, sign * radius));
-                float nDotOs = v3dot(triNorm, v3sub(planePoint, start));
-                float t = nDotOs / nDotD;
-                if (t >= 0.f && t < bestT) {
-                    // Check if hit point (back-projected onto triangle plane) is inside triangle
-                    Vector3 hitPt    = v3add(start, v3scale(d, t));
-                    Vector3 onPlane  = v3sub(hitPt, v3scale(triNorm, sign * radius));
-                    Vector3 closest  = ClosestPtTriangle(onPlane, ta, tb, tc);
-                    if (v3len(v3sub(onPlane, closest)) < 1e-4f) {
-                        bestT = t;
-                        bestN = v3scale(triNorm, (float)sign);
-                    }
-                }
-            }
-        }
+static StaticMeshEntry FindMesh(int handle) {
+    std::lock_guard<std::mutex> lk(g_meshMutex);
+    for (const auto& e : g_staticMeshes)
+        if (e.handle == handle) return e;
+    return {};
+}
+
+// Run `query` on the BVH of `handle`, whichever layout it was built in.
+// False when the mesh is unknown, not built yet or empty.
+template<typename Query>
+static bool WithStaticMesh(int handle, Query&& query) {
+    StaticMeshEntry mesh = FindMesh(handle);
+    if (mesh.bvh4 && !mesh.bvh4->Empty())     { query(*mesh.bvh4); return true; }
+    if (mesh.bvh  && !mesh.bvh->nodes.empty()) { query(*mesh.bvh);  return true; }
+    return false;
+}
+
+static bool IsRegistered(int handle) {
+    std::lock_guard<std::mutex> lk(g_meshMutex);
+    for (const auto& e : g_staticMeshes)
+        if (e.handle == handle) return true;
+    return false;
+}
+
+// ─── World tree ───────────────────────────────────────────────────────────────
+
+static void BuildWorldNode(WorldTree& world, int begin, int end) {
+    const int idx = static_cast<int>(world.nodes.size());
+    world.nodes.emplace_back();
+
+    BVHNode node;
+    node.bmin = world.meshes[begin].bmin;
+    node.bmax = world.meshes[begin].bmax;
+    Vector3 clo = v3scale(v3add(node.bmin, node.bmax), 0.5f), chi = clo;
+    for (int i = begin + 1; i < end; ++i) {
+        const StaticMeshEntry& m = world.meshes[i];
+        node.bmin = v3min(node.bmin, m.bmin);
+        node.bmax = v3max(node.bmax, m.bmax);
+        const Vector3 c = v3scale(v3add(m.bmin, m.bmax), 0.5f);
+        clo = v3min(clo, c);
+        chi = v3max(chi, c);
+    }
+    if (end - begin == 1) {
+        node.triStart = begin;
+        node.triCount = 1;
+        world.nodes[idx] = node;
+        return;
     }
 
-    // ── 2. Ray vs edge capsules ───────────────────────────────────────────────
-    Vector3 edges[3][2] = { {ta,tb}, {tb,tc}, {tc,ta} };
-    for (auto& e : edges) {
-        float t = RayCylinder(start, d, e[0], e[1], radius, 0.f, bestT);
-        if (t < bestT) {
-            // Compute normal = (hitPoint - closestPointOnEdge) normalised
-            Vector3 hitPt   = v3add(start, v3scale(d, t));
-            Vector3 ab      = v3sub(e[1], e[0]);
-            float abL2      = v3dot(ab,ab);
-            float proj      = abL2 > 1e-10f ? v3dot(v3sub(hitPt, e[0]), ab) / abL2 : 0.f;
-            proj             = proj < 0.f ? 0.f : (proj > 1.f ? 1.f : proj);
-            Vector3 closest = v3add(e[0], v3scale(ab, proj));
-            Vector3 n       = v3sub(hitPt, closest);
-            float nlen      = v3len(n);
-            if (nlen > 1e-6f) {
-                bestT = t;
-                bestN = v3scale(n, 1.f/nlen);
-            }
-        }
+    const Vector3 extent = v3sub(chi, clo);
+    const int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+    auto centre = [axis](const StaticMeshEntry& m) {
+        const float lo[3] = { m.bmin.x, m.bmin.y, m.bmin.z }, hi[3] = { m.bmax.x, m.bmax.y, m.bmax.z };
+        return lo[axis] + hi[axis];
+    };
+    const int mid = begin + (end - begin) / 2;
+    std::nth_element(world.meshes.begin() + begin, world.meshes.begin() + mid, world.meshes.begin() + end,
+                     [&](const StaticMeshEntry& a, const StaticMeshEntry& b) { return centre(a) < centre(b); });
+
+    BuildWorldNode(world, begin, mid);                        // left child: idx + 1
+    node.rightChild = static_cast<int>(world.nodes.size());
+    BuildWorldNode(world, mid, end);
+    world.nodes[idx] = node;
+}
+
+// Tree over `meshes` (every one queryable). Median splits keep it balanced,
+// so it is ⌈log2 n⌉ deep and far inside the BVH::MAX_DEPTH traversal stack.
+static std::shared_ptr<const WorldTree> BuildWorldTree(std::vector<StaticMeshEntry> meshes) {
+    auto world = std::make_shared<WorldTree>();
+    world->meshes = std::move(meshes);
+    if (!world->meshes.empty()) {
+        world->nodes.reserve(2 * world->meshes.size() - 1);
+        BuildWorldNode(*world, 0, static_cast<int>(world->meshes.size()));
     }
+    return world;
+}
+
+// Republish g_world from the registry; call with g_meshMutex held.
+static void RebuildWorldLocked() {
+    std::vector<StaticMeshEntry> meshes;
+    for (const auto& e : g_staticMeshes)
+        if (e.Queryable()) meshes.push_back(e);
+    g_world = BuildWorldTree(std::move(meshes));
+}
+
+static std::shared_ptr<const WorldTree> SnapshotWorld() {
+    std::lock_guard<std::mutex> lk(g_meshMutex);
+    return g_world;
+}
+
+// Run `query` on whichever layout `mesh` was built in.
+template<typename Query>
+static void QueryMesh(const StaticMeshEntry& mesh, Query&& query) {
+    if (mesh.bvh4) query(*mesh.bvh4);
+    else           query(*mesh.bvh);
+}
 
-    // ── 3. Ray vs vertex spheres ──────────────────────────────────────────────
-    Vector3 verts[3] = { ta, tb, tc };
-    for (auto& v : verts) {
-        float t = RaySphere(start, d, v, radius, 0.f, bestT);
-        if (t < bestT) {
-            Vector3 hitPt = v3add(start, v3scale(d, t));
-            Vector3 n     = v3sub(hitPt, v);
-            float nlen    = v3len(n);
-            if (nlen > 1e-6f) {
-                bestT = t;
-                bestN = v3scale(n, 1.f/nlen);
+// Near-to-far walk of the world tree, as TraverseOrdered walks a mesh BVH.
+// enter(node) is the entry distance of the node's box against the query's
+// current best, FLT_MAX to cull it; visit(mesh) runs the mesh query. A
+// deferred node is tested again when popped, since the meshes visited in
+// the meantime may have tightened the query.
+template<typename Enter, typename Visit>
+static void WalkWorld(const WorldTree& world, Enter&& enter, Visit&& visit) {
+    if (world.nodes.empty() || enter(world.nodes[0]) == FLT_MAX) return;
+    int stack[BVH::MAX_DEPTH];
+    int sp  = 0;
+    int idx = 0;
+    for (;;) {
+        const BVHNode& node = world.nodes[idx];
+        if (node.rightChild == -1) {
+            visit(world.meshes[node.triStart]);
+        } else {
+            int   a = idx + 1, b = node.rightChild;
+            float ta = enter(world.nodes[a]), tb = enter(world.nodes[b]);
+            if (tb < ta) { std::swap(a, b); std::swap(ta, tb); }
+            if (ta != FLT_MAX) {
+                if (tb != FLT_MAX) stack[sp++] = b;
+                idx = a;
+                continue;
             }
         }
+        for (;;) {
+            if (sp == 0) return;
+            const int next = stack[--sp];
+            if (enter(world.nodes[next]) != FLT_MAX) { idx = next; break; }
+        }
     }
-
-    if (bestT > 1.f + 1e-6f) return FLT_MAX; // no hit within segment
-    outNormal = bestN;
-    return bestT;
 }
 
-// ─── BVH ─────────────────────────────────────────────────────────────────────
-
-struct Tri {
-    Vector3 a, b, c;
-    Vector3 centroid;
-};
+// ─── Batched rays ─────────────────────────────────────────────────────────────
 
-struct BVHNode {
-    // AABB enclosing all triangles in this subtree
-    Vector3 bmin, bmax;
-    // If leaf: [triStart, triStart+triCount)  in the reordered triangle array
-    // If internal: left child = index+1, right child = rightChild
-    int triStart = 0, triCount = 0;
-    int rightChild = -1; // -1 → leaf
-};
+static inline uint32_t RayOctant(const Vector3& d) {
+    return (d.x < 0.f ? 1u : 0u) | (d.y < 0.f ? 2u : 0u) | (d.z < 0.f ? 4u : 0u);
+}
 
-struct BVH {
-    std::vector<BVHNode> nodes;
-    std::vector<Tri>     tris;   // reordered
-
-    // Build from a flat triangle list
-    void Build(std::vector<Tri>&& inTris) {
-        tris = std::move(inTris);
-        if (tris.empty()) return;
-        nodes.clear();
-        nodes.reserve(tris.size() * 2);
-        BuildNode(0, (int)tris.size(), 0);
-    }
+// Spread the low 9 bits of v so that bit i lands at bit 3i.
+static inline uint32_t Spread9(uint32_t v) {
+    v &= 0x1ffu;
+    v = (v | v << 16) & 0x030000ffu;
+    v = (v | v << 8)  & 0x0300f00fu;
+    v = (v | v << 4)  & 0x030c30c3u;
+    v = (v | v << 2)  & 0x09249249u;
+    return v;
+}
 
-private:
-    static Vector3 TriAabbMin(const Tri& t) {
-        return { fminf(t.a.x, fminf(t.b.x, t.c.x)),
-                 fminf(t.a.y, fminf(t.b.y, t.c.y)),
-                 fminf(t.a.z, fminf(t.b.z, t.c.z)) };
+// Trace order for a batch: grouped by direction octant, then along a Morton
+// curve of the origins over the batch bounds, so the rays packed together
+// start near each other and visit nearly the same nodes.
+static std::vector<uint32_t> CoherenceOrder(std::span<const Hotones::Physics::BatchRay> rays) {
+    Vector3 lo = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+    Vector3 hi = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    for (const auto& r : rays) {
+        lo = v3min(lo, r.origin);
+        hi = v3max(hi, r.origin);
     }
-    static Vector3 TriAabbMax(const Tri& t) {
-        return { fmaxf(t.a.x, fmaxf(t.b.x, t.c.x)),
-                 fmaxf(t.a.y, fmaxf(t.b.y, t.c.y)),
-                 fmaxf(t.a.z, fmaxf(t.b.z, t.c.z)) };
+    auto quantise = [](float v, float l, float h) -> uint32_t {
+        const float q = (h > l) ? (v - l) / (h - l) * 511.f : 0.f;
+        if (!(q > 0.f)) return 0u;
+        return q < 511.f ? static_cast<uint32_t>(q) : 511u;
+    };
+
+    std::vector<uint64_t> keys(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) {
+        const auto& r = rays[i];
+        const uint32_t morton = Spread9(quantise(r.origin.x, lo.x, hi.x))
+                              | Spread9(quantise(r.origin.y, lo.y, hi.y)) << 1
+                              | Spread9(quantise(r.origin.z, lo.z, hi.z)) << 2;
+        const uint64_t key = static_cast<uint64_t>(RayOctant(r.dir)) << 27 | morton;
+        keys[i] = key << 32 | static_cast<uint32_t>(i);
     }
+    std::sort(keys.begin(), keys.end());
 
-    int BuildNode(int start, int end, int /*depth*/) {
-        int nodeIdx = (int)nodes.size();
-        nodes.push_back({});
-        BVHNode& node = nodes[nodeIdx];
-
-        // Compute AABB
-        node.bmin = TriAabbMin(tris[start]);
-        node.bmax = TriAabbMax(tris[start]);
-        for (int i = start+1; i < end; ++i) {
-            Vector3 mn = TriAabbMin(tris[i]);
-            Vector3 mx = TriAabbMax(tris[i]);
-            node.bmin = { fminf(node.bmin.x, mn.x), fminf(node.bmin.y, mn.y), fminf(node.bmin.z, mn.z) };
-            node.bmax = { fmaxf(node.bmax.x, mx.x), fmaxf(node.bmax.y, mx.y), fmaxf(node.bmax.z, mx.z) };
-        }
+    std::vector<uint32_t> order(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) order[i] = static_cast<uint32_t>(keys[i]);
+    return order;
+}
 
-        int count = end - start;
-        if (count <= 4) {
-            // Leaf
-            node.triStart = start;
-            node.triCount = count;
-            node.rightChild = -1;
-            return nodeIdx;
+// Trace order[begin, end) four rays at a time through `world`, keeping each
+// ray's nearest hit and the mesh it came from. A node is entered when any
+// lane's ray enters it before that lane's best hit. Returns the hit count.
+static int TraceBatchRange(const WorldTree& world,
+                           std::span<const Hotones::Physics::BatchRay> rays,
+                           std::span<Hotones::Physics::BatchHit> hits,
+                           const uint32_t* order, size_t begin, size_t end, bool packets) {
+    int hitCount = 0;
+    for (size_t i = begin; i < end; i += 4) {
+        const size_t lanes = std::min<size_t>(4, end - i);
+        Vector3 ro[4], rd[4], bestN[4];
+        Hotones::Physics::detail::SlabRay slab[4];
+        float   bestT[4];
+        int     bestHandle[4];
+        bool    coherent = packets && lanes > 1;
+        for (size_t k = 0; k < 4; ++k) {
+            bestN[k]      = { 0, 1, 0 };
+            bestHandle[k] = -1;
+            if (k < lanes) {
+                const auto& r = rays[order[i + k]];
+                ro[k]    = r.origin;
+                rd[k]    = r.dir;
+                bestT[k] = r.maxDist;
+                slab[k]  = Hotones::Physics::detail::MakeSlabRay(r.origin, r.dir);
+                coherent = coherent && RayOctant(r.dir) == RayOctant(rays[order[i]].dir);
+            } else {
+                ro[k] = rd[k] = { 0, 0, 0 };
+                bestT[k] = -1.f;    // idle lane
+            }
         }
 
-        // Split on longest axis at centroid median
-        Vector3 ext = v3sub(node.bmax, node.bmin);
-        int axis = (ext.x > ext.y && ext.x > ext.z) ? 0 : (ext.y > ext.z ? 1 : 2);
-        float mid = 0.f;
-        for (int i = start; i < end; ++i) {
-            float* c = &tris[i].centroid.x;
-            mid += c[axis];
+        auto enter = [&](const BVHNode& node) {
+            float t = FLT_MAX;
+            for (size_t k = 0; k < lanes; ++k)
+                t = std::min(t, Hotones::Physics::detail::SlabEnter(slab[k], node, 0.f, bestT[k]));
+            return t;
+        };
+        WalkWorld(world, enter, [&](const StaticMeshEntry& mesh) {
+            float before[4];
+            std::memcpy(before, bestT, sizeof(bestT));
+            QueryMesh(mesh, [&](const auto& bvh) {
+                if (coherent) { bvh.Raycast4(ro, rd, bestT, bestN); return; }
+                for (size_t k = 0; k < lanes; ++k) bvh.Raycast(ro[k], rd[k], bestT[k], bestN[k]);
+            });
+            for (size_t k = 0; k < lanes; ++k)
+                if (bestT[k] < before[k]) bestHandle[k] = mesh.handle;
+        });
+
+        for (size_t k = 0; k < lanes; ++k) {
+            const uint32_t idx = order[i + k];
+            Hotones::Physics::BatchHit& out = hits[idx];
+            out = {};
+            if (bestHandle[k] < 0) continue;
+            out.hit    = true;
+            out.t      = bestT[k];
+            out.normal = bestN[k];
+            out.pos    = v3add(rays[idx].origin, v3scale(rays[idx].dir, bestT[k]));
+            out.handle = bestHandle[k];
+            ++hitCount;
         }
-        mid /= (float)count;
-
-        auto midIt = std::partition(tris.begin() + start, tris.begin() + end,
-                                    [axis, mid](const Tri& t){
-                                        const float* c = &t.centroid.x;
-                                        return c[axis] < mid;
-                                    });
-        int split = (int)(midIt - tris.begin());
-        if (split == start || split == end) split = start + count / 2;
-
-        node.triStart = -1; node.triCount = 0;
-        BuildNode(start, split, 0);                    // left child (always nodeIdx+1)
-        node.rightChild = BuildNode(split, end, 0);    // right child
-        // Re-fetch reference after possible vector reallocation
-        nodes[nodeIdx].rightChild = node.rightChild;
-        return nodeIdx;
     }
-};
+    return hitCount;
+}
 
-// AABB vs expanded AABB (expand box by radius) overlap check
-static bool AabbOverlap(Vector3 bmin, Vector3 bmax, Vector3 qmin, Vector3 qmax) {
-    return (bmin.x <= qmax.x && bmax.x >= qmin.x) &&
-           (bmin.y <= qmax.y && bmax.y >= qmin.y) &&
-           (bmin.z <= qmax.z && bmax.z >= qmin.z);
-}
-
-// Traverse BVH for sweep; returns earliest t.
-static void SweepNodeBVH(const BVH& bvh, int nodeIdx,
-                          Vector3 start, Vector3 end, float radius,
-                          float& bestT, Vector3& bestN) {
-    if (nodeIdx < 0 || nodeIdx >= (int)bvh.nodes.size()) return;
-    const BVHNode& node = bvh.nodes[nodeIdx];
-
-    // Expand node AABB by radius and do a quick overlap test with the swept AABB of the sphere
-    Vector3 swMin = { fminf(start.x, end.x) - radius,
-                      fminf(start.y, end.y) - radius,
-                      fminf(start.z, end.z) - radius };
-    Vector3 swMax = { fmaxf(start.x, end.x) + radius,
-                      fmaxf(start.y, end.y) + radius,
-                      fmaxf(start.z, end.z) + radius };
-    if (!AabbOverlap(node.bmin, node.bmax, swMin, swMax)) return;
-
-    if (node.rightChild == -1) {
-        // Leaf — test each triangle
-        for (int i = node.triStart; i < node.triStart + node.triCount; ++i) {
-            const Tri& tri = bvh.tris[i];
-            Vector3 n;
-            float t = SweepSphereTriangle(start, end, radius, tri.a, tri.b, tri.c, n);
-            if (t < bestT) { bestT = t; bestN = n; }
-        }
-        return;
+static int RaycastBatchImpl(int handle, bool all,
+                            std::span<const Hotones::Physics::BatchRay> rays,
+                            std::span<Hotones::Physics::BatchHit> hits,
+                            const Hotones::Physics::RaycastBatchOptions& options) {
+    const size_t count = std::min(rays.size(), hits.size());
+    rays = rays.first(count);
+    hits = hits.first(count);
+    for (auto& h : hits) h = {};
+
+    // One lock for the whole batch; a single mesh gets a one-leaf tree.
+    std::shared_ptr<const WorldTree> world;
+    if (all) {
+        world = SnapshotWorld();
+    } else if (StaticMeshEntry mesh = FindMesh(handle); mesh.Queryable()) {
+        world = BuildWorldTree({ std::move(mesh) });
     }
-    // Internal — recurse both children
-    SweepNodeBVH(bvh, nodeIdx + 1,        start, end, radius, bestT, bestN);
-    SweepNodeBVH(bvh, node.rightChild,    start, end, radius, bestT, bestN);
-}
-
-// Traverse BVH for penetration resolution — collect all triangles whose closest
-// point to `center` is within `radius`.
-static void PenetrationNodeBVH(const BVH& bvh, int nodeIdx,
-                                Vector3 center, float radius,
-                                Vector3& outPush, bool& didPush) {
-    if (nodeIdx < 0 || nodeIdx >= (int)bvh.nodes.size()) return;
-    const BVHNode& node = bvh.nodes[nodeIdx];
-
-    // Quick AABB cull (expand by radius)
-    if (center.x + radius < node.bmin.x || center.x - radius > node.bmax.x ||
-        center.y + radius < node.bmin.y || center.y - radius > node.bmax.y ||
-        center.z + radius < node.bmin.z || center.z - radius > node.bmax.z) return;
-
-    if (node.rightChild == -1) {
-        for (int i = node.triStart; i < node.triStart + node.triCount; ++i) {
-            const Tri& tri = bvh.tris[i];
-            Vector3 closest = ClosestPtTriangle(center, tri.a, tri.b, tri.c);
-            Vector3 diff    = v3sub(center, closest);
-            float dist2     = v3dot(diff, diff);
-            if (dist2 < radius * radius) {
-                float dist = sqrtf(dist2);
-                Vector3 n;
-                if (dist > 1e-6f) {
-                    n = v3scale(diff, 1.f / dist);
-                } else {
-                    // Center is on the triangle — push out along face normal
-                    n = v3norm(v3cross(v3sub(tri.b, tri.a), v3sub(tri.c, tri.a)));
-                }
-                float depth = radius - dist;
-                outPush  = v3add(outPush, v3scale(n, depth));
-                didPush  = true;
-            }
-        }
-        return;
+    if (!world || world->meshes.empty() || count == 0) return 0;
+
+    std::vector<uint32_t> order;
+    if (options.sortRays) {
+        order = CoherenceOrder(rays);
+    } else {
+        order.resize(count);
+        for (size_t i = 0; i < count; ++i) order[i] = static_cast<uint32_t>(i);
     }
-    PenetrationNodeBVH(bvh, nodeIdx + 1,     center, radius, outPush, didPush);
-    PenetrationNodeBVH(bvh, node.rightChild, center, radius, outPush, didPush);
-}
-
-// ─── Static mesh registry ─────────────────────────────────────────────────────
 
-struct StaticMeshEntry {
-    int  handle = 0;
-    BVH  bvh;
-};
-
-static std::vector<StaticMeshEntry> g_staticMeshes;
-static int                          g_nextHandle = 1;
-static std::mutex                   g_meshMutex;
-// Background BVH build queue and worker
-struct BuildTask {
-    int handle = -1;
-    std::vector<Tri> tris;
-};
-static std::deque<BuildTask>        g_buildQueue;
-static std::mutex                   g_buildMutex;
-static std::condition_variable      g_buildCv;
-static std::thread                  g_buildWorker;
-static std::atomic<bool>            g_buildRunning{false};
-// Forward-declare worker function so InitPhysics can start the thread
-namespace Hotones { namespace Physics { void BuildWorkerThread(); } }
+    const size_t chunk = (std::max<size_t>(options.raysPerJob, 4) + 3) & ~size_t(3);
+    if (!options.jobs || count <= chunk)
+        return TraceBatchRange(*world, rays, hits, order.data(), 0, count, options.packets);
+
+    std::atomic<int> hitCount{0};
+    Hotones::ECS::JobSystem::Counter done;
+    for (size_t begin = 0; begin < count; begin += chunk) {
+        const size_t end = std::min(begin + chunk, count);
+        options.jobs->Submit([&, begin, end] {
+            hitCount.fetch_add(TraceBatchRange(*world, rays, hits, order.data(), begin, end,
+                                               options.packets), std::memory_order_relaxed);
+        }, done);
+    }
+    options.jobs->Wait(done);
+    return hitCount.load(std::memory_order_relaxed);
+}
 
 namespace Hotones { namespace Physics {
 
-bool InitPhysics() {
-    if (!g_buildRunning.load()) {
-        g_buildRunning.store(true);
-        g_buildWorker = std::thread(BuildWorkerThread);
-        TraceLog(LOG_INFO, "[Physics] BVH worker thread started");
-    }
+bool InitPhysics(unsigned buildWorkers) {
+    AcquireBuildJobs(buildWorkers);
     return true;
 }
 
 void ShutdownPhysics() {
-    g_buildRunning.store(false);
-    g_buildCv.notify_all();
-    if (g_buildWorker.joinable()) g_buildWorker.join();
-    g_staticMeshes.clear();
+    // Queued builds see the flag and return at once; running ones finish.
+    // A WaitForStaticMeshBuilds still helping on the pool may be the one to
+    // join it, but every build is over before the registry is cleared.
+    g_cancelBuilds.store(true, std::memory_order_release);
+    std::shared_ptr<ECS::JobSystem> jobs;
+    {
+        std::lock_guard<std::mutex> lk(g_jobsMutex);
+        jobs = std::move(g_buildJobs);
+    }
+    if (jobs) jobs->Wait(g_buildCounter);
+    jobs.reset();
+    g_cancelBuilds.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lk(g_meshMutex);
+        g_staticMeshes.clear();
+        g_world.reset();
+        g_pendingBuilds = 0;
+    }
+    g_buildDoneCv.notify_all();
     TraceLog(LOG_INFO, "[Physics] Shutdown complete");
 }
 
+void SetBVHBuildOptions(const BVHBuildOptions& options) {
+    std::lock_guard<std::mutex> lk(g_meshMutex);
+    g_buildOptions = options;
+}
+
+BVHBuildOptions GetBVHBuildOptions() {
+    std::lock_guard<std::mutex> lk(g_meshMutex);
+    return g_buildOptions;
+}
+
+// Job body: build the BVH for `handle` and publish it, unless the mesh was
+// unregistered (or physics shut down) while the job sat in the queue.
+// `jobs` is the pool running the job, which outlives it.
+static void BuildStaticMesh(int handle, std::vector<Tri>& tris, const BVHBuildOptions& options,
+                            ECS::JobSystem* jobs) {
+    std::shared_ptr<BVH>  bvh;
+    std::shared_ptr<BVH4> bvh4;
+    Vector3 bmin = { 0, 0, 0 }, bmax = { 0, 0, 0 };
+    size_t triCount = 0, nodeCount = 0;
+    double ms = 0.0;
+    if (!g_cancelBuilds.load(std::memory_order_acquire) && IsRegistered(handle)) {
+        auto t0 = std::chrono::steady_clock::now();
+        bvh = std::make_shared<BVH>();
+        bvh->Build(std::move(tris), options, jobs);
+        if (!bvh->nodes.empty()) {
+            bmin = bvh->nodes[0].bmin;
+            bmax = bvh->nodes[0].bmax;
+        }
+        if (options.layout == BVHLayout::Wide4) {
+            bvh4 = std::make_shared<BVH4>();
+            bvh4->Collapse(std::move(*bvh));
+            bvh.reset();
+            triCount  = bvh4->tris.size();
+            nodeCount = bvh4->nodes.size();
+        } else {
+            triCount  = bvh->tris.size();
+            nodeCount = bvh->nodes.size();
+        }
+        ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+    {
+        std::lock_guard<std::mutex> lk(g_meshMutex);
+        --g_pendingBuilds;
+        for (auto& e : g_staticMeshes) {
+            if (e.handle == handle && (bvh || bvh4)) {
+                e.bvh  = bvh;
+                e.bvh4 = bvh4;
+                e.bmin = bmin;
+                e.bmax = bmax;
+                RebuildWorldLocked();
+                TraceLog(LOG_INFO, "[Physics] Built mesh handle=%d tris=%zu bvh_nodes=%zu (%s%s, %.1f ms)",
+                         handle, triCount, nodeCount,
+                         options.builder == BVHBuilder::BinnedSAH ? "SAH" : "mean",
+                         bvh4 ? ", 4-wide" : "", ms);
+                break;
+            }
+        }
+    }
+    g_buildDoneCv.notify_all();
+}
+
 int RegisterStaticMeshFromModel(const Model& model, const Vector3& position) {
     if (model.meshCount <= 0 || model.meshes == nullptr) return -1;
 
@@ -447,85 +506,93 @@ int RegisterStaticMeshFromModel(const Model& model, const Vector3& position) {
 
     if (tris.empty()) return -1;
 
+    const std::shared_ptr<ECS::JobSystem> jobs = AcquireBuildJobs(0);
+
     // Create a placeholder entry immediately so callers get a handle
-    StaticMeshEntry entry;
-    entry.handle = g_nextHandle++;
+    int handle;
+    BVHBuildOptions options;
     {
         std::lock_guard<std::mutex> lk(g_meshMutex);
+        handle = g_nextHandle++;
+        StaticMeshEntry entry;
+        entry.handle = handle;
         g_staticMeshes.push_back(std::move(entry));
+        ++g_pendingBuilds;
+        options = g_buildOptions;
     }
 
-    // Queue building the BVH in the background to avoid stalls during loading
-    BuildTask task;
-    task.handle = g_nextHandle - 1;
-    task.tris = std::move(tris);
-    {
-        std::lock_guard<std::mutex> lk(g_buildMutex);
-        g_buildQueue.push_back(std::move(task));
-    }
-    g_buildCv.notify_one();
-
-    TraceLog(LOG_INFO, "[Physics] Queued mesh build handle=%d tris=%zu", (g_nextHandle - 1), task.tris.size());
-    return (g_nextHandle - 1);
+    // Build the BVH in the background to avoid stalls during loading
+    TraceLog(LOG_INFO, "[Physics] Queued mesh build handle=%d tris=%zu", handle, tris.size());
+    jobs->Submit([handle, tris = std::move(tris), options, pool = jobs.get()]() mutable {
+        BuildStaticMesh(handle, tris, options, pool);
+    }, g_buildCounter);
+    return handle;
 }
 
 void UnregisterStaticMesh(int handle) {
-    std::lock_guard<std::mutex> lk(g_meshMutex);
-    for (auto it = g_staticMeshes.begin(); it != g_staticMeshes.end(); ++it) {
-        if (it->handle == handle) { g_staticMeshes.erase(it); return; }
+    {
+        std::lock_guard<std::mutex> lk(g_meshMutex);
+        for (auto it = g_staticMeshes.begin(); it != g_staticMeshes.end(); ++it) {
+            if (it->handle == handle) {
+                const bool inWorld = it->Queryable();
+                g_staticMeshes.erase(it);
+                if (inWorld) RebuildWorldLocked();
+                break;
+            }
+        }
     }
+    g_buildDoneCv.notify_all();
 }
 
-// Background builder thread function
-void BuildWorkerThread() {
-    while (g_buildRunning.load()) {
-        BuildTask task;
-        {
-            std::unique_lock<std::mutex> lk(g_buildMutex);
-            g_buildCv.wait(lk, []{ return !g_buildQueue.empty() || !g_buildRunning.load(); });
-            if (!g_buildRunning.load() && g_buildQueue.empty()) return;
-            task = std::move(g_buildQueue.front());
-            g_buildQueue.pop_front();
-        }
+bool IsStaticMeshReady(int handle) {
+    return FindMesh(handle).Built();
+}
 
-        // Build BVH (potentially expensive) outside mesh lock
-        BVH builtBvh;
-        builtBvh.Build(std::move(task.tris));
+bool WaitForStaticMesh(int handle, float timeoutSeconds) {
+    std::unique_lock<std::mutex> lk(g_meshMutex);
+    auto settled = [handle] {
+        for (const auto& e : g_staticMeshes)
+            if (e.handle == handle) return e.Built();
+        return true;   // unregistered
+    };
+    if (timeoutSeconds < 0.f) g_buildDoneCv.wait(lk, settled);
+    else g_buildDoneCv.wait_for(lk, std::chrono::duration<float>(timeoutSeconds), settled);
+    for (const auto& e : g_staticMeshes)
+        if (e.handle == handle) return e.Built();
+    return false;
+}
+
+int PendingStaticMeshBuilds() {
+    std::lock_guard<std::mutex> lk(g_meshMutex);
+    return g_pendingBuilds;
+}
 
-        // Assign the built BVH back to the registered mesh if it still exists
+bool WaitForStaticMeshBuilds(float timeoutSeconds) {
+    if (timeoutSeconds < 0.f) {
+        std::shared_ptr<ECS::JobSystem> jobs;
         {
-            std::lock_guard<std::mutex> lk(g_meshMutex);
-            for (auto &e : g_staticMeshes) {
-                if (e.handle == task.handle) {
-                    e.bvh = std::move(builtBvh);
-                    TraceLog(LOG_INFO, "[Physics] Built mesh handle=%d tris=%zu bvh_nodes=%zu",
-                             e.handle, e.bvh.tris.size(), e.bvh.nodes.size());
-                    break;
-                }
-            }
+            std::lock_guard<std::mutex> lk(g_jobsMutex);
+            jobs = g_buildJobs;
         }
+        if (jobs) jobs->Wait(g_buildCounter);   // help build
+        return PendingStaticMeshBuilds() == 0;
     }
+    std::unique_lock<std::mutex> lk(g_meshMutex);
+    return g_buildDoneCv.wait_for(lk, std::chrono::duration<float>(timeoutSeconds),
+                                  [] { return g_pendingBuilds == 0; });
 }
 
-// BVH worker is started by InitPhysics() and stopped by ShutdownPhysics().
 
 bool SweepSphereAgainstStatic(int handle,
                                const Vector3& start, const Vector3& end,
                                float radius,
                                Vector3& hitPos, Vector3& hitNormal, float& t) {
-    // Grab a reference to the entry under lock, then release before traversal
-    const BVH* bvhPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lk(g_meshMutex);
-        for (const auto& e : g_staticMeshes)
-            if (e.handle == handle) { bvhPtr = &e.bvh; break; }
-        if (!bvhPtr || bvhPtr->nodes.empty()) return false;
-    }
-
-    // Safe to read without lock since meshes are immutable once registered
+    // Takes a reference under the lock, then traverses without it: a
+    // published BVH is never modified
     float bestT = FLT_MAX;
     Vector3 bestN = { 0,1,0 };
-    SweepNodeBVH(*bvhPtr, 0, start, end, radius, bestT, bestN);
+    if (!WithStaticMesh(handle, [&](const auto& bvh) { bvh.SweepSphere(start, end, radius, bestT, bestN); }))
+        return false;
 
     if (bestT > 1.f + 1e-6f) return false;
 
@@ -538,105 +605,19 @@ bool SweepSphereAgainstStatic(int handle,
 // New: resolve sphere penetration against a registered static mesh.
 // Pushes `center` out of all overlapping triangles. Returns true if any push occurred.
 bool ResolveSphereAgainstStatic(int handle, Vector3& center, float radius) {
-    const BVH* bvhPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lk(g_meshMutex);
-        for (const auto& e : g_staticMeshes)
-            if (e.handle == handle) { bvhPtr = &e.bvh; break; }
-        if (!bvhPtr || bvhPtr->nodes.empty()) return false;
-    }
-
     Vector3 totalPush = {0,0,0};
     bool    pushed    = false;
-    PenetrationNodeBVH(*bvhPtr, 0, center, radius, totalPush, pushed);
+    WithStaticMesh(handle, [&](const auto& bvh) { bvh.ResolveSphere(center, radius, totalPush, pushed); });
     if (pushed) center = v3add(center, totalPush);
     return pushed;
 }
 
-// ─── Raycasting ───────────────────────────────────────────────────────────────
-
-// Slab-based ray vs AABB. Returns true if the ray [0, tMax] hits the box.
-static bool RayAabb(Vector3 ro, Vector3 rd, Vector3 bmin, Vector3 bmax, float tMax) {
-    float tEnter = 0.f;
-    for (int i = 0; i < 3; ++i) {
-        float o  = (&ro.x)[i];
-        float d  = (&rd.x)[i];
-        float mn = (&bmin.x)[i];
-        float mx = (&bmax.x)[i];
-        if (fabsf(d) < 1e-10f) {
-            if (o < mn || o > mx) return false;
-        } else {
-            float t1 = (mn - o) / d;
-            float t2 = (mx - o) / d;
-            if (t1 > t2) { float tmp = t1; t1 = t2; t2 = tmp; }
-            tEnter = fmaxf(tEnter, t1);
-            tMax   = fminf(tMax,   t2);
-            if (tEnter > tMax) return false;
-        }
-    }
-    return true;
-}
-
-// Möller-Trumbore ray-vs-triangle. Returns t > 0 on hit, FLT_MAX otherwise.
-// Fills outNormal with the face normal flipped toward the ray origin.
-static float RayTriangleMT(Vector3 ro, Vector3 rd,
-                             Vector3 ta, Vector3 tb, Vector3 tc,
-                             Vector3& outNormal) {
-    const float EPS = 1e-8f;
-    Vector3 e1  = v3sub(tb, ta);
-    Vector3 e2  = v3sub(tc, ta);
-    Vector3 h   = v3cross(rd, e2);
-    float   a   = v3dot(e1, h);
-    if (fabsf(a) < EPS) return FLT_MAX;   // Ray parallel to triangle
-    float   f   = 1.f / a;
-    Vector3 s   = v3sub(ro, ta);
-    float   u   = f * v3dot(s, h);
-    if (u < 0.f || u > 1.f) return FLT_MAX;
-    Vector3 q   = v3cross(s, e1);
-    float   v   = f * v3dot(rd, q);
-    if (v < 0.f || u + v > 1.f) return FLT_MAX;
-    float   t   = f * v3dot(e2, q);
-    if (t < 1e-6f) return FLT_MAX;        // Behind ray origin
-    Vector3 n = v3norm(v3cross(e1, e2));
-    // Flip so the normal faces the incoming ray
-    if (v3dot(n, rd) > 0.f) n = v3scale(n, -1.f);
-    outNormal = n;
-    return t;
-}
-
-// BVH traversal for raycasting — records the nearest hit.
-static void RaycastNodeBVH(const BVH& bvh, int nodeIdx,
-                             Vector3 ro, Vector3 rd, float& bestT, Vector3& bestN) {
-    if (nodeIdx < 0 || nodeIdx >= (int)bvh.nodes.size()) return;
-    const BVHNode& node = bvh.nodes[nodeIdx];
-    if (!RayAabb(ro, rd, node.bmin, node.bmax, bestT)) return;
-    if (node.rightChild == -1) {
-        // Leaf — test each triangle
-        for (int i = node.triStart; i < node.triStart + node.triCount; ++i) {
-            const Tri& tri = bvh.tris[i];
-            Vector3 n;
-            float t = RayTriangleMT(ro, rd, tri.a, tri.b, tri.c, n);
-            if (t < bestT) { bestT = t; bestN = n; }
-        }
-        return;
-    }
-    RaycastNodeBVH(bvh, nodeIdx + 1,       ro, rd, bestT, bestN);
-    RaycastNodeBVH(bvh, node.rightChild,   ro, rd, bestT, bestN);
-}
-
 bool RaycastAgainstStatic(int handle, const Vector3& origin, const Vector3& dir,
                            float maxDist, Vector3& hitPos, Vector3& hitNormal, float& t) {
-    const BVH* bvhPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lk(g_meshMutex);
-        for (const auto& e : g_staticMeshes)
-            if (e.handle == handle) { bvhPtr = &e.bvh; break; }
-        if (!bvhPtr || bvhPtr->nodes.empty()) return false;
-    }
-
     float   bestT = maxDist;
     Vector3 bestN = { 0, 1, 0 };
-    RaycastNodeBVH(*bvhPtr, 0, origin, dir, bestT, bestN);
+    if (!WithStaticMesh(handle, [&](const auto& bvh) { bvh.Raycast(origin, dir, bestT, bestN); }))
+        return false;
 
     if (bestT >= maxDist) return false;
 
@@ -646,4 +627,94 @@ bool RaycastAgainstStatic(int handle, const Vector3& origin, const Vector3& dir,
     return true;
 }
 
+bool RaycastWorld(const Vector3& origin, const Vector3& dir, float maxDist,
+                  Vector3& hitPos, Vector3& hitNormal, float& t, int& hitHandle) {
+    std::shared_ptr<const WorldTree> world = SnapshotWorld();
+    if (!world) return false;
+
+    float   bestT      = maxDist;
+    Vector3 bestN      = { 0, 1, 0 };
+    int     bestHandle = -1;
+    const detail::SlabRay ray = detail::MakeSlabRay(origin, dir);
+    WalkWorld(*world, [&](const BVHNode& node) { return detail::SlabEnter(ray, node, 0.f, bestT); },
+              [&](const StaticMeshEntry& mesh) {
+        const float before = bestT;
+        QueryMesh(mesh, [&](const auto& bvh) { bvh.Raycast(origin, dir, bestT, bestN); });
+        if (bestT < before) bestHandle = mesh.handle;
+    });
+    if (bestHandle < 0) return false;
+
+    t         = bestT;
+    hitNormal = bestN;
+    hitPos    = v3add(origin, v3scale(dir, bestT));
+    hitHandle = bestHandle;
+    return true;
+}
+
+bool SweepSphereWorld(const Vector3& start, const Vector3& end, float radius,
+                      Vector3& hitPos, Vector3& hitNormal, float& t, int& hitHandle) {
+    std::shared_ptr<const WorldTree> world = SnapshotWorld();
+    if (!world) return false;
+
+    const float tLimit     = 1.f + 1e-6f;
+    float       bestT      = FLT_MAX;
+    Vector3     bestN      = { 0, 1, 0 };
+    int         bestHandle = -1;
+    const detail::SlabRay ray = detail::MakeSlabRay(start, v3sub(end, start));
+    WalkWorld(*world, [&](const BVHNode& node) {
+        return detail::SlabEnter(ray, node, radius, std::min(bestT, tLimit));
+    }, [&](const StaticMeshEntry& mesh) {
+        const float before = bestT;
+        QueryMesh(mesh, [&](const auto& bvh) { bvh.SweepSphere(start, end, radius, bestT, bestN); });
+        if (bestT < before) bestHandle = mesh.handle;
+    });
+    if (bestHandle < 0 || bestT > tLimit) return false;
+
+    t         = bestT;
+    hitNormal = bestN;
+    hitPos    = v3add(start, v3scale(v3sub(end, start), bestT));
+    hitHandle = bestHandle;
+    return true;
+}
+
+bool ResolveSphereWorld(Vector3& center, float radius, int& hitHandle) {
+    std::shared_ptr<const WorldTree> world = SnapshotWorld();
+    if (!world) return false;
+
+    Vector3 totalPush  = { 0, 0, 0 };
+    float   deepest    = -1.f;
+    int     bestHandle = -1;
+    const Vector3 lo = v3sub(center, { radius, radius, radius });
+    const Vector3 hi = v3add(center, { radius, radius, radius });
+    WalkWorld(*world, [&](const BVHNode& node) {
+        const bool overlap = lo.x <= node.bmax.x && hi.x >= node.bmin.x &&
+                             lo.y <= node.bmax.y && hi.y >= node.bmin.y &&
+                             lo.z <= node.bmax.z && hi.z >= node.bmin.z;
+        return overlap ? 0.f : FLT_MAX;
+    }, [&](const StaticMeshEntry& mesh) {
+        Vector3 push   = { 0, 0, 0 };
+        bool    pushed = false;
+        QueryMesh(mesh, [&](const auto& bvh) { bvh.ResolveSphere(center, radius, push, pushed); });
+        if (!pushed) return;
+        totalPush = v3add(totalPush, push);
+        const float depth = Vector3Length(push);
+        if (depth > deepest) { deepest = depth; bestHandle = mesh.handle; }
+    });
+    if (bestHandle < 0) return false;
+
+    center    = v3add(center, totalPush);
+    hitHandle = bestHandle;
+    return true;
+}
+
+int RaycastBatch(int handle, std::span<const BatchRay> rays, std::span<BatchHit> hits,
+                 const RaycastBatchOptions& options) {
+    return RaycastBatchImpl(handle, false, rays, hits, options);
+}
+
+int RaycastBatchWorld(std::span<const BatchRay> rays, std::span<BatchHit> hits,
+                      const RaycastBatchOptions& options) {
+    return RaycastBatchImpl(0, true, rays, hits, options);
+}
+
 }} // namespace Hotones::Physics
@@ -67,7 +67,8 @@ void Player::Update() {
     float newHeadSin = sinf(headTimer * PI);
     if (body.isGrounded && ((forward != 0) || (sideway != 0))) {
         if (prevHeadSin <= 0.0f && newHeadSin > 0.0f && walkLerp > 0.1f) {
-            Ho_tones::GetSoundBus().PlaySequentialAsync("footstep", 1.0f);
+            static const Hotones::StringId s_footstep("footstep");
+            Ho_tones::GetSoundBus().PlaySequentialAsync(s_footstep, 1.0f);
         }
     }
     prevHeadSin = newHeadSin;
@@ -27,9 +27,9 @@ namespace Ho_tones {
     // instances from the in-memory Wave for overlapping playback without
     // reading from disk repeatedly.
     struct LoadedEntry { Sound sound; Wave wave; std::string path; };
-    static std::unordered_map<std::string, std::vector<LoadedEntry>> loadedSounds;
+    static std::unordered_map<Hotones::StringId, std::vector<LoadedEntry>> loadedSounds;
     // Round-robin index for sequential playback per-name
-    static std::unordered_map<std::string, size_t> sequentialIndex;
+    static std::unordered_map<Hotones::StringId, size_t> sequentialIndex;
     static std::mt19937 rng((unsigned)std::chrono::high_resolution_clock::now().time_since_epoch().count());
 
     struct SoundBus::Voice {
@@ -75,7 +75,7 @@ namespace Ho_tones {
         return true;
     }
 
-    bool SoundBus::LoadSoundFile(const std::string& name, const std::string& filePath) {
+    bool SoundBus::LoadSoundFile(Hotones::StringId name, const std::string& filePath) {
         if (!IsAudioDeviceReady()) return false;
         try {
             // Resolve the path via the asset system so callers can pass
@@ -99,12 +99,12 @@ namespace Ho_tones {
         }
     }
 
-    bool SoundBus::PlayLoaded(const std::string& name, float gain) {
+    bool SoundBus::PlayLoaded(Hotones::StringId name, float gain) {
         // Play first variant (if any)
         return PlayRandom(name, gain);
     }
 
-    bool SoundBus::PlayRandom(const std::string& name, float gain) {
+    bool SoundBus::PlayRandom(Hotones::StringId name, float gain) {
         if (!IsAudioDeviceReady()) return false;
         auto it = loadedSounds.find(name);
         if (it == loadedSounds.end() || it->second.empty()) return false;
@@ -117,7 +117,7 @@ namespace Ho_tones {
         return true;
     }
 
-    bool SoundBus::PlaySequential(const std::string& name, float gain) {
+    bool SoundBus::PlaySequential(Hotones::StringId name, float gain) {
         if (!IsAudioDeviceReady()) return false;
         auto it = loadedSounds.find(name);
         if (it == loadedSounds.end() || it->second.empty()) return false;
@@ -132,7 +132,7 @@ namespace Ho_tones {
         return true;
     }
 
-    bool SoundBus::PlaySequentialAsync(const std::string& name, float gain) {
+    bool SoundBus::PlaySequentialAsync(Hotones::StringId name, float gain) {
         if (!IsAudioDeviceReady()) return false;
         auto it = loadedSounds.find(name);
         if (it == loadedSounds.end() || it->second.empty()) return false;
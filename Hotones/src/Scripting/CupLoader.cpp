@@ -53,6 +53,37 @@ namespace {
         lua_pushnumber(L, (lua_Number)secs);
         return 1;
     }
+
+    // Read the optional Init.ECS table (memory hints) from the Init table at
+    // stack index init. Non-positive or non-integer counts are ignored.
+    Hotones::Scripting::ECSMemoryHints readECSMemoryHints(lua_State* L, int init) {
+        Hotones::Scripting::ECSMemoryHints hints;
+        lua_getfield(L, init, "ECS");
+        if (lua_istable(L, -1)) {
+            auto count = [L](int idx) -> size_t {
+                const lua_Integer v = lua_isinteger(L, idx) ? lua_tointeger(L, idx) : 0;
+                return v > 0 ? static_cast<size_t>(v) : 0u;
+            };
+            lua_getfield(L, -1, "ArenaKB");
+            hints.arenaBytes = count(-1) * 1024u;
+            lua_getfield(L, -2, "Entities");
+            hints.entities = count(-1);
+            lua_pop(L, 2);
+
+            lua_getfield(L, -1, "Reserve");
+            if (lua_istable(L, -1)) {
+                lua_pushnil(L);
+                while (lua_next(L, -2)) {
+                    if (lua_type(L, -2) == LUA_TSTRING && count(-1) > 0)
+                        hints.reserve.emplace_back(lua_tostring(L, -2), count(-1));
+                    lua_pop(L, 1);
+                }
+            }
+            lua_pop(L, 1);
+        }
+        lua_pop(L, 1);
+        return hints;
+    }
 } // anonymous namespace
 
 // Internal reload request flag (global for the single CupLoader instance).
@@ -246,6 +277,8 @@ bool CupLoader::loadPak(CupPackage& pkg)
         TraceLog(LOG_INFO, "[CupLoader] Pack debug mode enabled.");
     lua_pop(L, 1);
 
+    m_ecsHints = readECSMemoryHints(L, lua_gettop(L));
+
     lua_getfield(L, -1, "MainClass");
     if (lua_istable(L, -1)) {
         m_classRef = luaL_ref(L, LUA_REGISTRYINDEX);
@@ -339,6 +372,8 @@ bool CupLoader::reload()
     }
     lua_pop(newL, 1);
 
+    ECSMemoryHints newHints = readECSMemoryHints(newL, lua_gettop(newL));
+
     int newClassRef = LUA_NOREF;
     lua_getfield(newL, -1, "MainClass");
     if (lua_istable(newL, -1)) {
@@ -358,6 +393,7 @@ bool CupLoader::reload()
     L = newL;
     m_classRef = newClassRef;
     if (!newMainScene.empty()) m_mainScene = newMainScene;
+    m_ecsHints = std::move(newHints);
 
     // Call Init() on the new MainClass (if one existed)
     if (m_classRef != LUA_NOREF) callMethod("Init");
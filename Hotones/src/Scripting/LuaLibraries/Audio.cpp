@@ -15,11 +15,12 @@ static int l_loadSound(lua_State* L)
 }
 
 // audio.play(name [, gain]) -> bool
+// Names never loaded are looked up without being interned.
 static int l_play(lua_State* L)
 {
     const char* name = luaL_checkstring(L, 1);
     float gain = (float)luaL_optnumber(L, 2, 1.0);
-    bool ok = Ho_tones::GetSoundBus().PlayLoaded(name, gain);
+    bool ok = Ho_tones::GetSoundBus().PlayLoaded(Hotones::StringId::Find(name), gain);
     lua_pushboolean(L, ok ? 1 : 0);
     return 1;
 }
@@ -29,7 +30,7 @@ static int l_playRandom(lua_State* L)
 {
     const char* name = luaL_checkstring(L, 1);
     float gain = (float)luaL_optnumber(L, 2, 1.0);
-    bool ok = Ho_tones::GetSoundBus().PlayRandom(name, gain);
+    bool ok = Ho_tones::GetSoundBus().PlayRandom(Hotones::StringId::Find(name), gain);
     lua_pushboolean(L, ok ? 1 : 0);
     return 1;
 }
@@ -39,7 +40,7 @@ static int l_playSequential(lua_State* L)
 {
     const char* name = luaL_checkstring(L, 1);
     float gain = (float)luaL_optnumber(L, 2, 1.0);
-    bool ok = Ho_tones::GetSoundBus().PlaySequential(name, gain);
+    bool ok = Ho_tones::GetSoundBus().PlaySequential(Hotones::StringId::Find(name), gain);
     lua_pushboolean(L, ok ? 1 : 0);
     return 1;
 }
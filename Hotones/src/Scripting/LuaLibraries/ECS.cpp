@@ -1,7 +1,15 @@
 #include <lua.hpp>
 #include <ECS/ECS.hpp>
 #include <GFX/Player.hpp>
+#include <Scripting/CupLoader.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
 #include "../../include/Scripting/LuaLoader/ECS.hpp"
+#include "../../include/Scripting/LuaLoader/Tables.hpp"
 
 // ── Module-level state ────────────────────────────────────────────────────────
 // These pointers are set by the scene before registering / every time the
@@ -12,10 +20,28 @@ namespace Hotones::Scripting::LuaLoader {
 namespace {
     static ECS::Registry* g_registry    = nullptr;
     static Hotones::Player* g_ecsPlayer = nullptr;
+
+    // Prefabs registered with ecs.prefab(); handle = index + 1. They are
+    // plain values, so they outlive registry switches.
+    static std::vector<ECS::Prefab> g_prefabs;
+
+    // Reverse tag index for ecs.findByTag, built on first use per registry.
+    static std::unique_ptr<ECS::TagIndex> g_tagIndex;
+
+    // Spatial index owned by the scene's scheduler (ecs.queryRadius).
+    static ECS::SpatialIndexSystem* g_spatial = nullptr;
+
+    // Result buffer reused by ecs.queryRadius / ecs.query.
+    static std::vector<ECS::EntityId> g_queryHits;
 } // anonymous namespace
 
-void setECSRegistry(ECS::Registry* reg)      { g_registry  = reg; }
+void setECSRegistry(ECS::Registry* reg)
+{
+    if (reg != g_registry) g_tagIndex.reset();   // detach while the old registry is still alive
+    g_registry = reg;
+}
 void setECSLocalPlayer(Hotones::Player* p)   { g_ecsPlayer = p;   }
+void setECSSpatialIndex(ECS::SpatialIndexSystem* index) { g_spatial = index; }
 
 // ── Helpers ───────────────────────────────────────────────────────────────────
 
@@ -31,6 +57,35 @@ static inline ECS::EntityId toEntityId(lua_State* L, int idx)
     return static_cast<ECS::EntityId>(luaL_checkinteger(L, idx));
 }
 
+// Edit entity id's T through `edit`, adding a default T first if it has none.
+//
+// Lua may be called from inside a View / Each (e.g. a system driving script
+// callbacks). Adding a component there would reshuffle the pool being walked,
+// so the add is routed into the registry's command buffer instead and the
+// edit is applied to the staged value. Several setters hitting the same
+// entity before the flush merge into that one staged add.
+template<typename T, typename Fn>
+static void editOrAdd(ECS::EntityId id, Fn&& edit)
+{
+    if (g_registry->HasComponent<T>(id)) {
+        edit(g_registry->GetComponent<T>(id));
+    } else if (g_registry->IsIterating()) {
+        auto& cmds = g_registry->Commands();
+        if (T* pending = cmds.Pending<T>(id)) edit(*pending);
+        else                                  edit(cmds.Add<T>(id));
+    } else {
+        edit(g_registry->AddComponent<T>(id));
+    }
+}
+
+// Read entity id's T without counting as a change for the registry's change
+// tracking (getters must not look like writes to replication / sync).
+template<typename T>
+static const T& readComponent(ECS::EntityId id)
+{
+    return std::as_const(*g_registry).GetComponent<T>(id);
+}
+
 // Push three zeros — used for missing-component fallbacks.
 static inline int push3zeros(lua_State* L)
 {
@@ -38,6 +93,15 @@ static inline int push3zeros(lua_State* L)
     return 3;
 }
 
+// Entry i of the array at (absolute) index t, as an entity id.
+static inline ECS::EntityId idAt(lua_State* L, int t, lua_Integer i)
+{
+    lua_rawgeti(L, t, i);
+    const auto id = static_cast<ECS::EntityId>(lua_tointeger(L, -1));
+    lua_pop(L, 1);
+    return id;
+}
+
 // ── Entity management ─────────────────────────────────────────────────────────
 
 // ecs.create() → id
@@ -48,11 +112,11 @@ static int l_create(lua_State* L)
     return 1;
 }
 
-// ecs.destroy(id)
+// ecs.destroy(id) — also unlinks id from its parent; its children become roots
 static int l_destroy(lua_State* L)
 {
     if (!registryReady(L)) return 0;
-    g_registry->DestroyEntity(toEntityId(L, 1));
+    ECS::DestroyLinked(*g_registry, toEntityId(L, 1));
     return 0;
 }
 
@@ -64,8 +128,132 @@ static int l_isAlive(lua_State* L)
     return 1;
 }
 
+// ── Prefabs ──────────────────────────────────────────────────────────────────
+
+// Read field `key` of the table at idx as {x, y, z} into out.
+// Returns false (out untouched) if the field is not a table.
+static bool readVec3Field(lua_State* L, int idx, const char* key, Vector3& out)
+{
+    if (lua_getfield(L, idx, key) != LUA_TTABLE) { lua_pop(L, 1); return false; }
+    lua_rawgeti(L, -1, 1); lua_rawgeti(L, -2, 2); lua_rawgeti(L, -3, 3);
+    out = { static_cast<float>(lua_tonumber(L, -3)),
+            static_cast<float>(lua_tonumber(L, -2)),
+            static_cast<float>(lua_tonumber(L, -1)) };
+    lua_pop(L, 4);
+    return true;
+}
+
+// ecs.prefab(desc) → prefab handle
+//   desc is either an entity id — its Transform, Velocity, Tag, Group,
+//   Health, Lifetime and AudioEmitter components are copied — or a table:
+//   { pos = {x,y,z}, scale = {x,y,z}, velocity = {x,y,z}, tag = "name",
+//     health = maxHp, lifetime = seconds, group = n, collider = radius }
+//   (all optional).
+//   Register prefabs once (at load), not per spawn.
+static int l_prefab(lua_State* L)
+{
+    ECS::Prefab prefab;
+    if (lua_istable(L, 1)) {
+        Vector3 v;
+        if (readVec3Field(L, 1, "pos", v))   prefab.Set<ECS::TransformComponent>().position = v;
+        if (readVec3Field(L, 1, "scale", v)) {
+            if (!prefab.Has<ECS::TransformComponent>()) prefab.Set<ECS::TransformComponent>();
+            prefab.Get<ECS::TransformComponent>().scale = v;
+        }
+        if (readVec3Field(L, 1, "velocity", v)) prefab.Set<ECS::VelocityComponent>().linear = v;
+        if (lua_getfield(L, 1, "tag") == LUA_TSTRING)
+            prefab.Set<ECS::TagComponent>().name = lua_tostring(L, -1);
+        if (lua_getfield(L, 1, "health") == LUA_TNUMBER) {
+            const float hp = static_cast<float>(lua_tonumber(L, -1));
+            prefab.Set<ECS::HealthComponent>(ECS::HealthComponent{ hp, hp });
+        }
+        if (lua_getfield(L, 1, "lifetime") == LUA_TNUMBER)
+            prefab.Set<ECS::LifetimeComponent>().remaining = static_cast<float>(lua_tonumber(L, -1));
+        if (lua_getfield(L, 1, "group") == LUA_TNUMBER)
+            prefab.Set<ECS::GroupComponent>().groupId = static_cast<uint32_t>(lua_tointeger(L, -1));
+        if (lua_getfield(L, 1, "collider") == LUA_TNUMBER)
+            prefab.Set<ECS::ColliderSphereComponent>().radius = static_cast<float>(lua_tonumber(L, -1));
+        lua_pop(L, 5);
+    } else {
+        if (!registryReady(L)) { lua_pushnil(L); return 1; }
+        auto id = toEntityId(L, 1);
+        if (!g_registry->IsAlive(id)) { lua_pushnil(L); return 1; }
+        prefab = ECS::Prefab::FromEntity<ECS::TransformComponent, ECS::VelocityComponent,
+                                         ECS::TagComponent, ECS::GroupComponent,
+                                         ECS::HealthComponent, ECS::LifetimeComponent,
+                                         ECS::AudioEmitterComponent>(*g_registry, id);
+    }
+    g_prefabs.push_back(std::move(prefab));
+    lua_pushinteger(L, static_cast<lua_Integer>(g_prefabs.size()));
+    return 1;
+}
+
+// ecs.spawn(prefab, n [, positions]) → { id, ... }
+//   Creates n copies of the prefab in one call. positions, if given, is a
+//   flat array { x1, y1, z1, x2, y2, z2, ... }: entity i is placed at the
+//   i-th triple (entities past the end keep the prefab's position).
+static int l_spawn(lua_State* L)
+{
+    const lua_Integer handle = luaL_checkinteger(L, 1);
+    const lua_Integer n      = luaL_checkinteger(L, 2);
+    if (!registryReady(L) || handle < 1 || handle > static_cast<lua_Integer>(g_prefabs.size()) || n <= 0) {
+        lua_createtable(L, 0, 0);
+        return 1;
+    }
+
+    std::vector<ECS::EntityId> ids(static_cast<size_t>(n));
+    g_registry->Instantiate(g_prefabs[static_cast<size_t>(handle - 1)], ids);
+
+    if (lua_istable(L, 3)) {
+        const size_t placed = std::min(ids.size(), static_cast<size_t>(lua_rawlen(L, 3) / 3));
+        for (size_t i = 0; i < placed; ++i) {
+            lua_rawgeti(L, 3, static_cast<lua_Integer>(3 * i + 1));
+            lua_rawgeti(L, 3, static_cast<lua_Integer>(3 * i + 2));
+            lua_rawgeti(L, 3, static_cast<lua_Integer>(3 * i + 3));
+            const Vector3 p = { static_cast<float>(lua_tonumber(L, -3)),
+                                static_cast<float>(lua_tonumber(L, -2)),
+                                static_cast<float>(lua_tonumber(L, -1)) };
+            lua_pop(L, 3);
+            editOrAdd<ECS::TransformComponent>(ids[i], [&](auto& t) { t.position = p; });
+        }
+    }
+
+    lua_createtable(L, static_cast<int>(ids.size()), 0);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        lua_pushinteger(L, static_cast<lua_Integer>(ids[i]));
+        lua_rawseti(L, -2, static_cast<lua_Integer>(i + 1));
+    }
+    return 1;
+}
+
 // ── Transform ────────────────────────────────────────────────────────────────
 
+// Move live entity id to p. A player entity also teleports the engine
+// player, which otherwise overwrites the Transform on the next frame.
+static void moveEntity(ECS::EntityId id, Vector3 p)
+{
+    if (g_registry->HasComponent<ECS::PlayerComponent>(id)) {
+        const auto& pc = readComponent<ECS::PlayerComponent>(id);
+        if (pc.player) pc.player->body.position = p;
+    }
+    editOrAdd<ECS::TransformComponent>(id, [&](auto& t) { t.position = p; });
+}
+
+// Position of live entity id into out: the engine player's for a player
+// entity, else its Transform's. False (out untouched) if it has neither.
+static bool entityPosition(ECS::EntityId id, Vector3& out)
+{
+    if (g_registry->HasComponent<ECS::PlayerComponent>(id)) {
+        const auto& pc = readComponent<ECS::PlayerComponent>(id);
+        if (pc.player) { out = pc.player->body.position; return true; }
+    }
+    if (g_registry->HasComponent<ECS::TransformComponent>(id)) {
+        out = readComponent<ECS::TransformComponent>(id).position;
+        return true;
+    }
+    return false;
+}
+
 // ecs.setPos(id, x, y, z)
 static int l_setPos(lua_State* L)
 {
@@ -75,14 +263,7 @@ static int l_setPos(lua_State* L)
     float y  = static_cast<float>(luaL_checknumber(L, 3));
     float z  = static_cast<float>(luaL_checknumber(L, 4));
     if (!g_registry->IsAlive(id)) return 0;
-
-    // If this is a player entity, teleport the engine player directly.
-    if (g_registry->HasComponent<ECS::PlayerComponent>(id)) {
-        auto& pc = g_registry->GetComponent<ECS::PlayerComponent>(id);
-        if (pc.player) pc.player->body.position = {x, y, z};
-    }
-
-    g_registry->GetOrAdd<ECS::TransformComponent>(id).position = {x, y, z};
+    moveEntity(id, {x, y, z});
     return 0;
 }
 
@@ -91,28 +272,68 @@ static int l_getPos(lua_State* L)
 {
     if (!g_registry) return push3zeros(L);
     auto id = toEntityId(L, 1);
-    if (!g_registry->IsAlive(id)) return push3zeros(L);
+    Vector3 p;
+    if (!g_registry->IsAlive(id) || !entityPosition(id, p)) return push3zeros(L);
+    lua_pushnumber(L, p.x);
+    lua_pushnumber(L, p.y);
+    lua_pushnumber(L, p.z);
+    return 3;
+}
 
-    // Player entity: read live position from the engine Player.
-    if (g_registry->HasComponent<ECS::PlayerComponent>(id)) {
-        auto& pc = g_registry->GetComponent<ECS::PlayerComponent>(id);
-        if (pc.player) {
-            auto& p = pc.player->body.position;
-            lua_pushnumber(L, p.x);
-            lua_pushnumber(L, p.y);
-            lua_pushnumber(L, p.z);
-            return 3;
-        }
+// ── Hierarchy ────────────────────────────────────────────────────────────────
+
+// ecs.setParent(child, parent)  — parent nil (or omitted) detaches.
+// Ignored while the registry is iterating, or if it would create a cycle.
+static int l_setParent(lua_State* L)
+{
+    if (!registryReady(L)) return 0;
+    auto child = toEntityId(L, 1);
+    if (!g_registry->IsAlive(child)) return 0;
+    if (g_registry->IsIterating()) {
+        TraceLog(LOG_WARNING, "[ecs] setParent called during iteration — ignored");
+        return 0;
     }
 
-    if (g_registry->HasComponent<ECS::TransformComponent>(id)) {
-        auto& t = g_registry->GetComponent<ECS::TransformComponent>(id);
-        lua_pushnumber(L, t.position.x);
-        lua_pushnumber(L, t.position.y);
-        lua_pushnumber(L, t.position.z);
-        return 3;
+    if (lua_isnoneornil(L, 2)) {
+        ECS::ClearParent(*g_registry, child);
+        return 0;
     }
-    return push3zeros(L);
+    auto parent = toEntityId(L, 2);
+    if (!g_registry->IsAlive(parent)) return 0;
+    if (ECS::IsDescendantOf(*g_registry, parent, child)) {
+        TraceLog(LOG_WARNING, "[ecs] setParent would create a cycle — ignored");
+        return 0;
+    }
+    ECS::SetParent(*g_registry, child, parent);
+    return 0;
+}
+
+// ecs.getParent(id) → parent id or nil
+static int l_getParent(lua_State* L)
+{
+    if (!g_registry) { lua_pushnil(L); return 1; }
+    auto id = toEntityId(L, 1);
+    const ECS::EntityId parent =
+        g_registry->IsAlive(id) ? ECS::GetParent(*g_registry, id) : ECS::INVALID_ENTITY;
+    if (parent == ECS::INVALID_ENTITY) lua_pushnil(L);
+    else                               lua_pushinteger(L, static_cast<lua_Integer>(parent));
+    return 1;
+}
+
+// ecs.getWorldPos(id) → x, y, z  — cached world position of a hierarchy
+// member; same as getPos for entities outside any hierarchy.
+static int l_getWorldPos(lua_State* L)
+{
+    if (!g_registry) return push3zeros(L);
+    auto id = toEntityId(L, 1);
+    if (!g_registry->IsAlive(id)) return push3zeros(L);
+    if (!g_registry->HasComponent<ECS::WorldTransformComponent>(id)) return l_getPos(L);
+
+    const Matrix& m = readComponent<ECS::WorldTransformComponent>(id).matrix;
+    lua_pushnumber(L, m.m12);
+    lua_pushnumber(L, m.m13);
+    lua_pushnumber(L, m.m14);
+    return 3;
 }
 
 // ecs.setScale(id, sx, sy, sz)
@@ -124,7 +345,7 @@ static int l_setScale(lua_State* L)
     float sy = static_cast<float>(luaL_checknumber(L, 3));
     float sz = static_cast<float>(luaL_checknumber(L, 4));
     if (!g_registry->IsAlive(id)) return 0;
-    g_registry->GetOrAdd<ECS::TransformComponent>(id).scale = {sx, sy, sz};
+    editOrAdd<ECS::TransformComponent>(id, [&](auto& t) { t.scale = {sx, sy, sz}; });
     return 0;
 }
 
@@ -137,7 +358,7 @@ static int l_setVelocity(lua_State* L)
     float vy = static_cast<float>(luaL_checknumber(L, 3));
     float vz = static_cast<float>(luaL_checknumber(L, 4));
     if (!g_registry->IsAlive(id)) return 0;
-    g_registry->GetOrAdd<ECS::VelocityComponent>(id).linear = {vx, vy, vz};
+    editOrAdd<ECS::VelocityComponent>(id, [&](auto& v) { v.linear = {vx, vy, vz}; });
     return 0;
 }
 
@@ -147,7 +368,7 @@ static int l_getVelocity(lua_State* L)
     if (!g_registry) return push3zeros(L);
     auto id = toEntityId(L, 1);
     if (g_registry->IsAlive(id) && g_registry->HasComponent<ECS::VelocityComponent>(id)) {
-        auto& v = g_registry->GetComponent<ECS::VelocityComponent>(id).linear;
+        const auto& v = readComponent<ECS::VelocityComponent>(id).linear;
         lua_pushnumber(L, v.x);
         lua_pushnumber(L, v.y);
         lua_pushnumber(L, v.z);
@@ -165,7 +386,7 @@ static int l_setTag(lua_State* L)
     auto        id   = toEntityId(L, 1);
     const char* name = luaL_checkstring(L, 2);
     if (!g_registry->IsAlive(id)) return 0;
-    g_registry->GetOrAdd<ECS::TagComponent>(id).name = name;
+    editOrAdd<ECS::TagComponent>(id, [&](auto& t) { t.name = name; });
     return 0;
 }
 
@@ -175,12 +396,72 @@ static int l_getTag(lua_State* L)
     if (!g_registry) { lua_pushstring(L, ""); return 1; }
     auto id = toEntityId(L, 1);
     if (g_registry->IsAlive(id) && g_registry->HasComponent<ECS::TagComponent>(id))
-        lua_pushstring(L, g_registry->GetComponent<ECS::TagComponent>(id).name.c_str());
+        lua_pushstring(L, readComponent<ECS::TagComponent>(id).name.CStr());
     else
         lua_pushstring(L, "");
     return 1;
 }
 
+// ecs.findByTag(name) → { id, ... }  (empty if no live entity has the tag)
+static int l_findByTag(lua_State* L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    // Find, not intern: a tag nobody ever set cannot match anything.
+    const StringId tag = StringId::Find(name);
+    if (!g_registry || tag.Empty()) { lua_createtable(L, 0, 0); return 1; }
+
+    if (!g_tagIndex) g_tagIndex = std::make_unique<ECS::TagIndex>(*g_registry);
+    const std::span<const ECS::EntityId> found = g_tagIndex->Find(tag);
+    lua_createtable(L, static_cast<int>(found.size()), 0);
+    for (size_t i = 0; i < found.size(); ++i) {
+        lua_pushinteger(L, static_cast<lua_Integer>(found[i]));
+        lua_rawseti(L, -2, static_cast<lua_Integer>(i + 1));
+    }
+    return 1;
+}
+
+// ── Spatial queries ───────────────────────────────────────────────────────────
+
+// ecs.setCollider(id, radius)  — add/replace the entity's collider sphere,
+// which makes it visible to ecs.queryRadius (together with a position).
+static int l_setCollider(lua_State* L)
+{
+    if (!registryReady(L)) return 0;
+    auto  id     = toEntityId(L, 1);
+    float radius = static_cast<float>(luaL_checknumber(L, 2));
+    if (!g_registry->IsAlive(id)) return 0;
+    editOrAdd<ECS::ColliderSphereComponent>(id, [&](auto& c) { c.radius = radius; });
+    return 0;
+}
+
+// ecs.queryRadius(x, y, z, r [, out]) → out, count
+// Entities whose collider sphere overlaps the query sphere, as of the last
+// system update. Results go to out[1..count] (a new table if omitted); a
+// reused out table has its stale tail cleared, so per-frame queries don't
+// allocate.
+static int l_queryRadius(lua_State* L)
+{
+    const Vector3 center = {
+        static_cast<float>(luaL_checknumber(L, 1)),
+        static_cast<float>(luaL_checknumber(L, 2)),
+        static_cast<float>(luaL_checknumber(L, 3)),
+    };
+    const float radius = static_cast<float>(luaL_checknumber(L, 4));
+
+    g_queryHits.clear();
+    if (g_spatial) g_spatial->QuerySphere(center, radius, g_queryHits);
+    else           TraceLog(LOG_WARNING, "[ecs] Spatial index not set — queryRadius returns nothing");
+
+    const lua_Integer count = static_cast<lua_Integer>(g_queryHits.size());
+    pushOutArray(L, 5, count);
+    for (lua_Integer i = 0; i < count; ++i) {
+        lua_pushinteger(L, static_cast<lua_Integer>(g_queryHits[static_cast<size_t>(i)]));
+        lua_rawseti(L, -2, i + 1);
+    }
+    lua_pushinteger(L, count);
+    return 2;
+}
+
 // ── Health ────────────────────────────────────────────────────────────────────
 
 // ecs.addHealth(id, maxHp)  — creates HealthComponent; current = max
@@ -190,14 +471,7 @@ static int l_addHealth(lua_State* L)
     auto  id    = toEntityId(L, 1);
     float maxHp = static_cast<float>(luaL_checknumber(L, 2));
     if (!g_registry->IsAlive(id)) return 0;
-    if (!g_registry->HasComponent<ECS::HealthComponent>(id)) {
-        auto& h = g_registry->AddComponent<ECS::HealthComponent>(id);
-        h.max = h.current = maxHp;
-    } else {
-        auto& h  = g_registry->GetComponent<ECS::HealthComponent>(id);
-        h.max    = maxHp;
-        h.current = maxHp;
-    }
+    editOrAdd<ECS::HealthComponent>(id, [&](auto& h) { h.max = h.current = maxHp; });
     return 0;
 }
 
@@ -207,7 +481,7 @@ static int l_getHealth(lua_State* L)
     if (!g_registry) { lua_pushnumber(L, 0); lua_pushnumber(L, 0); return 2; }
     auto id = toEntityId(L, 1);
     if (g_registry->IsAlive(id) && g_registry->HasComponent<ECS::HealthComponent>(id)) {
-        const auto& h = g_registry->GetComponent<ECS::HealthComponent>(id);
+        const auto& h = readComponent<ECS::HealthComponent>(id);
         lua_pushnumber(L, h.current);
         lua_pushnumber(L, h.max);
     } else {
@@ -245,7 +519,7 @@ static int l_isDead(lua_State* L)
     auto id = toEntityId(L, 1);
     bool dead = g_registry->IsAlive(id)
              && g_registry->HasComponent<ECS::HealthComponent>(id)
-             && g_registry->GetComponent<ECS::HealthComponent>(id).isDead();
+             && readComponent<ECS::HealthComponent>(id).isDead();
     lua_pushboolean(L, dead ? 1 : 0);
     return 1;
 }
@@ -259,7 +533,7 @@ static int l_setLifetime(lua_State* L)
     auto  id  = toEntityId(L, 1);
     float sec = static_cast<float>(luaL_checknumber(L, 2));
     if (!g_registry->IsAlive(id)) return 0;
-    g_registry->GetOrAdd<ECS::LifetimeComponent>(id).remaining = sec;
+    editOrAdd<ECS::LifetimeComponent>(id, [&](auto& lt) { lt.remaining = sec; });
     return 0;
 }
 
@@ -269,7 +543,7 @@ static int l_getLifetime(lua_State* L)
     if (!g_registry) { lua_pushnumber(L, 0); return 1; }
     auto id = toEntityId(L, 1);
     if (g_registry->IsAlive(id) && g_registry->HasComponent<ECS::LifetimeComponent>(id))
-        lua_pushnumber(L, g_registry->GetComponent<ECS::LifetimeComponent>(id).remaining);
+        lua_pushnumber(L, readComponent<ECS::LifetimeComponent>(id).remaining);
     else
         lua_pushnumber(L, 0);
     return 1;
@@ -286,13 +560,14 @@ static int l_addPlayer(lua_State* L)
     if (!g_registry->IsAlive(id)) return 0;
 
     if (!g_registry->HasComponent<ECS::PlayerComponent>(id)) {
-        auto& pc    = g_registry->AddComponent<ECS::PlayerComponent>(id);
-        pc.player   = g_ecsPlayer;
-        // Mirror current engine bhop setting if a player is attached.
-        if (pc.player) pc.enableSourceBhop = pc.player->enableSourceBhop;
+        editOrAdd<ECS::PlayerComponent>(id, [](auto& pc) {
+            pc.player = g_ecsPlayer;
+            // Mirror current engine bhop setting if a player is attached.
+            if (pc.player) pc.enableSourceBhop = pc.player->enableSourceBhop;
+        });
     }
     // Ensure the entity also has a TransformComponent so getPos works.
-    g_registry->GetOrAdd<ECS::TransformComponent>(id);
+    editOrAdd<ECS::TransformComponent>(id, [](auto&) {});
     return 0;
 }
 
@@ -328,6 +603,212 @@ static int l_setPlayerBhop(lua_State* L)
     return 0;
 }
 
+// ── Batched access ───────────────────────────────────────────────────────────
+// One call for many entities: per-entity calls are dominated by crossing
+// into C and re-resolving the entity, not by the work done.
+
+// ecs.getPositions(ids [, xs, ys, zs]) → xs, ys, zs
+//   Positions of ids as three arrays (getPos per entry: 0 for entities that
+//   are dead or have no position). Pass xs, ys, zs back in to reuse them.
+static int l_getPositions(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    const lua_Integer n = static_cast<lua_Integer>(lua_rawlen(L, 1));
+    lua_settop(L, 4);
+    pushOutArray(L, 2, n);   // 5
+    pushOutArray(L, 3, n);   // 6
+    pushOutArray(L, 4, n);   // 7
+
+    // Pools resolved once for the batch; player entities take the getPos path.
+    const ECS::Registry* reg = g_registry;
+    const auto* transforms = reg ? reg->PoolPtr<ECS::TransformComponent>() : nullptr;
+    const auto* players    = reg ? reg->PoolPtr<ECS::PlayerComponent>()    : nullptr;
+    if (players && players->Size() == 0) players = nullptr;
+
+    for (lua_Integer i = 1; i <= n; ++i) {
+        const ECS::EntityId id  = idAt(L, 1, i);
+        const uint32_t      idx = ECS::EntityIndex(id);
+        Vector3 p = { 0.0f, 0.0f, 0.0f };
+        if (reg && reg->IsAlive(id)) {
+            if (players && players->Has(idx))              entityPosition(id, p);
+            else if (transforms && transforms->Has(idx))   p = transforms->Get(idx).position;
+        }
+        lua_pushnumber(L, p.x); lua_rawseti(L, 5, i);
+        lua_pushnumber(L, p.y); lua_rawseti(L, 6, i);
+        lua_pushnumber(L, p.z); lua_rawseti(L, 7, i);
+    }
+    return 3;
+}
+
+// ecs.setPositions(ids, xs, ys, zs)
+//   setPos(ids[i], xs[i], ys[i], zs[i]) for every i; dead ids are skipped.
+static int l_setPositions(lua_State* L)
+{
+    for (int arg = 1; arg <= 4; ++arg) luaL_checktype(L, arg, LUA_TTABLE);
+    const lua_Integer n = static_cast<lua_Integer>(lua_rawlen(L, 1));
+    for (int arg = 2; arg <= 4; ++arg)
+        luaL_argcheck(L, static_cast<lua_Integer>(lua_rawlen(L, arg)) >= n, arg, "shorter than ids");
+    if (!registryReady(L)) return 0;
+
+    // Entities that already have a Transform (and are not players) are
+    // written straight into the pool, stamped like GetComponent would.
+    auto&          transforms = g_registry->Pool<ECS::TransformComponent>();
+    const auto*    players    = std::as_const(*g_registry).PoolPtr<ECS::PlayerComponent>();
+    const uint32_t tick       = g_registry->Tick();
+    if (players && players->Size() == 0) players = nullptr;
+
+    for (lua_Integer i = 1; i <= n; ++i) {
+        const ECS::EntityId id = idAt(L, 1, i);
+        if (!g_registry->IsAlive(id)) continue;
+        const Vector3  p   = { numberAt(L, 2, i), numberAt(L, 3, i), numberAt(L, 4, i) };
+        const uint32_t idx = ECS::EntityIndex(id);
+        if (transforms.Has(idx) && !(players && players->Has(idx))) transforms.Write(idx, tick).position = p;
+        else                                                         moveEntity(id, p);
+    }
+    return 0;
+}
+
+// Fill column key of the result table at t with get(component) for ids.
+template<typename T, typename Get>
+static void fillColumn(lua_State* L, int t, const char* key, std::span<const ECS::EntityId> ids, Get&& get)
+{
+    const auto n = static_cast<lua_Integer>(ids.size());
+    pushOutField(L, t, key, n);
+    for (lua_Integer i = 0; i < n; ++i) {
+        get(L, readComponent<T>(ids[static_cast<size_t>(i)]));
+        lua_rawseti(L, -2, i + 1);
+    }
+    lua_pop(L, 1);
+}
+
+template<typename T>
+static const ECS::IPool* poolOf() { return std::as_const(*g_registry).PoolPtr<T>(); }
+
+template<typename T>
+static void reservePool(ECS::Registry& reg, size_t n) { reg.Reserve<T>(n); }
+
+// A component ecs.query can select, and the columns it fills. The names are
+// also the keys of Init.ECS.Reserve.
+struct QueryComponent {
+    const char*       name;
+    const ECS::IPool* (*pool)();
+    void              (*reserve)(ECS::Registry& reg, size_t n);
+    void              (*fill)(lua_State* L, int t, std::span<const ECS::EntityId> ids);
+};
+
+static const QueryComponent kQueryComponents[] = {
+    { "Transform", poolOf<ECS::TransformComponent>, reservePool<ECS::TransformComponent>, [](lua_State* L, int t, std::span<const ECS::EntityId> ids) {
+        using C = ECS::TransformComponent;
+        fillColumn<C>(L, t, "x", ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.position.x); });
+        fillColumn<C>(L, t, "y", ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.position.y); });
+        fillColumn<C>(L, t, "z", ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.position.z); });
+    } },
+    { "Velocity", poolOf<ECS::VelocityComponent>, reservePool<ECS::VelocityComponent>, [](lua_State* L, int t, std::span<const ECS::EntityId> ids) {
+        using C = ECS::VelocityComponent;
+        fillColumn<C>(L, t, "vx", ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.linear.x); });
+        fillColumn<C>(L, t, "vy", ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.linear.y); });
+        fillColumn<C>(L, t, "vz", ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.linear.z); });
+    } },
+    { "Health", poolOf<ECS::HealthComponent>, reservePool<ECS::HealthComponent>, [](lua_State* L, int t, std::span<const ECS::EntityId> ids) {
+        using C = ECS::HealthComponent;
+        fillColumn<C>(L, t, "hp",    ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.current); });
+        fillColumn<C>(L, t, "maxHp", ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.max); });
+    } },
+    { "Lifetime", poolOf<ECS::LifetimeComponent>, reservePool<ECS::LifetimeComponent>, [](lua_State* L, int t, std::span<const ECS::EntityId> ids) {
+        using C = ECS::LifetimeComponent;
+        fillColumn<C>(L, t, "lifetime", ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.remaining); });
+    } },
+    { "Tag", poolOf<ECS::TagComponent>, reservePool<ECS::TagComponent>, [](lua_State* L, int t, std::span<const ECS::EntityId> ids) {
+        using C = ECS::TagComponent;
+        fillColumn<C>(L, t, "tag", ids, [](lua_State* L, const C& c) { lua_pushstring(L, c.name.CStr()); });
+    } },
+    { "Group", poolOf<ECS::GroupComponent>, reservePool<ECS::GroupComponent>, [](lua_State* L, int t, std::span<const ECS::EntityId> ids) {
+        using C = ECS::GroupComponent;
+        fillColumn<C>(L, t, "group", ids, [](lua_State* L, const C& c) { lua_pushinteger(L, c.groupId); });
+    } },
+    { "Collider", poolOf<ECS::ColliderSphereComponent>, reservePool<ECS::ColliderSphereComponent>, [](lua_State* L, int t, std::span<const ECS::EntityId> ids) {
+        using C = ECS::ColliderSphereComponent;
+        fillColumn<C>(L, t, "radius", ids, [](lua_State* L, const C& c) { lua_pushnumber(L, c.radius); });
+    } },
+};
+
+// ecs.query(components [, out]) → out, n
+//   Every entity owning all of components (names from kQueryComponents),
+//   packed column-wise: out.ids[i] plus one array per field, e.g.
+//   out.x[i], out.hp[i]. Pass out back in to reuse its arrays.
+static int l_query(lua_State* L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    const QueryComponent* selected[std::size(kQueryComponents)];
+    size_t count = 0;
+    for (lua_Integer i = 1, n = static_cast<lua_Integer>(lua_rawlen(L, 1)); i <= n; ++i) {
+        lua_rawgeti(L, 1, i);
+        const char* name = lua_tostring(L, -1);
+        const auto* it = std::find_if(std::begin(kQueryComponents), std::end(kQueryComponents),
+            [&](const QueryComponent& c) { return name && std::strcmp(c.name, name) == 0; });
+        if (it == std::end(kQueryComponents))
+            return luaL_error(L, "ecs.query: unknown component '%s'", name ? name : "?");
+        lua_pop(L, 1);
+        if (std::find(selected, selected + count, it) == selected + count) selected[count++] = it;
+    }
+    luaL_argcheck(L, count > 0, 1, "no component names");
+
+    // Walk the smallest pool and keep the entities present in all others.
+    g_queryHits.clear();
+    if (g_registry) {
+        const ECS::IPool* pools[std::size(kQueryComponents)];
+        const ECS::IPool* smallest = nullptr;
+        for (size_t c = 0; c < count; ++c) {
+            pools[c] = selected[c]->pool();
+            if (!pools[c]) { smallest = nullptr; break; }
+            if (!smallest || pools[c]->Size() < smallest->Size()) smallest = pools[c];
+        }
+        if (smallest) {
+            for (const uint32_t idx : smallest->EntityIndices()) {
+                bool all = true;
+                for (size_t c = 0; c < count && all; ++c) all = pools[c]->Contains(idx);
+                if (all) g_queryHits.push_back(g_registry->EntityAt(idx));
+            }
+        }
+    }
+
+    lua_settop(L, 2);
+    if (!lua_istable(L, 2)) {
+        lua_pop(L, 1);
+        lua_createtable(L, 0, 4);
+    }
+    const auto n = static_cast<lua_Integer>(g_queryHits.size());
+    pushOutField(L, 2, "ids", n);
+    for (lua_Integer i = 0; i < n; ++i) {
+        lua_pushinteger(L, static_cast<lua_Integer>(g_queryHits[static_cast<size_t>(i)]));
+        lua_rawseti(L, -2, i + 1);
+    }
+    lua_pop(L, 1);
+    for (size_t c = 0; c < count; ++c) selected[c]->fill(L, 2, g_queryHits);
+    lua_pushinteger(L, n);
+    lua_setfield(L, 2, "n");
+
+    lua_pushinteger(L, n);
+    return 2;
+}
+
+// ── Memory hints ─────────────────────────────────────────────────────────────
+
+void reserveECS(ECS::Registry& reg, const ECSMemoryHints& hints)
+{
+    if (hints.arenaBytes && reg.EntityCount() == 0) reg.ReleaseMemory(hints.arenaBytes);
+    if (hints.entities) reg.ReserveEntities(hints.entities);
+    for (const auto& [name, count] : hints.reserve) {
+        const auto* it = std::find_if(std::begin(kQueryComponents), std::end(kQueryComponents),
+            [&](const QueryComponent& c) { return name == c.name; });
+        if (it == std::end(kQueryComponents)) {
+            TraceLog(LOG_WARNING, "[ecs] Init.ECS.Reserve: unknown component '%s' — ignored", name.c_str());
+            continue;
+        }
+        it->reserve(reg, count);
+    }
+}
+
 // ── Registration ─────────────────────────────────────────────────────────────
 
 void registerECS(lua_State* L)
@@ -337,15 +818,30 @@ void registerECS(lua_State* L)
         {"create",          l_create},
         {"destroy",         l_destroy},
         {"isAlive",         l_isAlive},
+        // Prefabs
+        {"prefab",          l_prefab},
+        {"spawn",           l_spawn},
         // Transform
         {"setPos",          l_setPos},
         {"getPos",          l_getPos},
         {"setScale",        l_setScale},
         {"setVelocity",     l_setVelocity},
         {"getVelocity",     l_getVelocity},
+        // Batched access
+        {"getPositions",    l_getPositions},
+        {"setPositions",    l_setPositions},
+        {"query",           l_query},
+        // Hierarchy
+        {"setParent",       l_setParent},
+        {"getParent",       l_getParent},
+        {"getWorldPos",     l_getWorldPos},
         // Tag
         {"setTag",          l_setTag},
         {"getTag",          l_getTag},
+        {"findByTag",       l_findByTag},
+        // Spatial queries
+        {"setCollider",     l_setCollider},
+        {"queryRadius",     l_queryRadius},
         // Health
         {"addHealth",       l_addHealth},
         {"getHealth",       l_getHealth},
@@ -1,7 +1,10 @@
 #include <lua.hpp>
 #include <raylib.h>
 #include "../../include/Scripting/LuaLoader/Physics.hpp"
+#include "../../include/Scripting/LuaLoader/Tables.hpp"
 #include "../../include/Physics/PhysicsSystem.hpp"
+#include "../../include/ECS/JobSystem.hpp"
+#include <vector>
 
 namespace Hotones::Scripting::LuaLoader {
 
@@ -86,10 +89,151 @@ static int l_sweepSphere(lua_State* L) {
     return 1;
 }
 
+// physics.raycastWorld(ox, oy, oz, dx, dy, dz [, maxDist])
+//
+// physics.raycast against every static mesh at once.
+//
+// Returns (on hit):   true, hitX, hitY, hitZ, normX, normY, normZ, t, handle
+// Returns (on miss):  false
+static int l_raycastWorld(lua_State* L) {
+    Vector3 origin  = { (float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2), (float)luaL_checknumber(L, 3) };
+    Vector3 dir     = { (float)luaL_checknumber(L, 4), (float)luaL_checknumber(L, 5), (float)luaL_checknumber(L, 6) };
+    float   maxDist = (float)luaL_optnumber(L, 7, 1000.0);
+    Vector3 hitPos  = { 0, 0, 0 };
+    Vector3 hitNorm = { 0, 1, 0 };
+    float   t       = 0.f;
+    int     handle  = -1;
+
+    bool hit = Hotones::Physics::RaycastWorld(origin, dir, maxDist, hitPos, hitNorm, t, handle);
+
+    lua_pushboolean(L, hit ? 1 : 0);
+    if (hit) {
+        lua_pushnumber(L, hitPos.x);
+        lua_pushnumber(L, hitPos.y);
+        lua_pushnumber(L, hitPos.z);
+        lua_pushnumber(L, hitNorm.x);
+        lua_pushnumber(L, hitNorm.y);
+        lua_pushnumber(L, hitNorm.z);
+        lua_pushnumber(L, t);
+        lua_pushinteger(L, handle);
+        return 9;
+    }
+    return 1;
+}
+
+// physics.sweepSphereWorld(sx, sy, sz, ex, ey, ez, radius)
+//
+// physics.sweepSphere against every static mesh at once.
+//
+// Returns (on hit):   true, hitX, hitY, hitZ, normX, normY, normZ, t, handle
+// Returns (on miss):  false
+static int l_sweepSphereWorld(lua_State* L) {
+    Vector3 start   = { (float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2), (float)luaL_checknumber(L, 3) };
+    Vector3 end     = { (float)luaL_checknumber(L, 4), (float)luaL_checknumber(L, 5), (float)luaL_checknumber(L, 6) };
+    float   radius  = (float)luaL_checknumber(L, 7);
+    Vector3 hitPos  = { 0, 0, 0 };
+    Vector3 hitNorm = { 0, 1, 0 };
+    float   t       = 0.f;
+    int     handle  = -1;
+
+    bool hit = Hotones::Physics::SweepSphereWorld(start, end, radius, hitPos, hitNorm, t, handle);
+
+    lua_pushboolean(L, hit ? 1 : 0);
+    if (hit) {
+        lua_pushnumber(L, hitPos.x);
+        lua_pushnumber(L, hitPos.y);
+        lua_pushnumber(L, hitPos.z);
+        lua_pushnumber(L, hitNorm.x);
+        lua_pushnumber(L, hitNorm.y);
+        lua_pushnumber(L, hitNorm.z);
+        lua_pushnumber(L, t);
+        lua_pushinteger(L, handle);
+        return 9;
+    }
+    return 1;
+}
+
+// physics.resolveSphereWorld(cx, cy, cz, radius)
+//
+// Push a sphere out of every static mesh it overlaps.
+//
+// Returns (pushed):   true, newX, newY, newZ, handle (the mesh that pushed furthest)
+// Returns (clear):    false
+static int l_resolveSphereWorld(lua_State* L) {
+    Vector3 center = { (float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2), (float)luaL_checknumber(L, 3) };
+    float   radius = (float)luaL_checknumber(L, 4);
+    int     handle = -1;
+
+    bool pushed = Hotones::Physics::ResolveSphereWorld(center, radius, handle);
+
+    lua_pushboolean(L, pushed ? 1 : 0);
+    if (pushed) {
+        lua_pushnumber(L, center.x);
+        lua_pushnumber(L, center.y);
+        lua_pushnumber(L, center.z);
+        lua_pushinteger(L, handle);
+        return 5;
+    }
+    return 1;
+}
+
+// physics.raycastBatch(handle, rays [, maxDist [, out]])
+//
+// Cast many rays in one call: rays is a flat array of six numbers per ray,
+// { ox, oy, oz, dx, dy, dz, ... }. handle = nil casts against every static
+// mesh, as physics.raycastWorld does. The rays are traced in coherent
+// packets, on the job workers when there are many. out, when given, is
+// refilled instead of allocating.
+//
+// Returns: hitCount, results — a flat array of eight numbers per ray,
+//          { t, hitX, hitY, hitZ, normX, normY, normZ, handle, ... },
+//          with t = -1 and handle = -1 on a miss.
+static int l_raycastBatch(lua_State* L) {
+    const bool  world   = lua_isnoneornil(L, 1);
+    const int   handle  = world ? 0 : (int)luaL_checkinteger(L, 1);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    const float maxDist = (float)luaL_optnumber(L, 3, 1000.0);
+
+    const lua_Integer count = static_cast<lua_Integer>(lua_rawlen(L, 2)) / 6;
+    std::vector<Hotones::Physics::BatchRay> rays(static_cast<size_t>(count));
+    for (lua_Integer i = 0; i < count; ++i) {
+        auto& r = rays[static_cast<size_t>(i)];
+        r.origin  = { numberAt(L, 2, 6*i + 1), numberAt(L, 2, 6*i + 2), numberAt(L, 2, 6*i + 3) };
+        r.dir     = { numberAt(L, 2, 6*i + 4), numberAt(L, 2, 6*i + 5), numberAt(L, 2, 6*i + 6) };
+        r.maxDist = maxDist;
+    }
+
+    std::vector<Hotones::Physics::BatchHit> hits(rays.size());
+    Hotones::Physics::RaycastBatchOptions options;
+    options.jobs = &Hotones::ECS::JobSystem::Get();
+    const int hitCount = world
+        ? Hotones::Physics::RaycastBatchWorld(rays, hits, options)
+        : Hotones::Physics::RaycastBatch(handle, rays, hits, options);
+
+    lua_pushinteger(L, hitCount);
+    pushOutArray(L, 4, 8 * count);
+    for (lua_Integer i = 0; i < count; ++i) {
+        const auto& h = hits[static_cast<size_t>(i)];
+        const lua_Number v[7] = { h.hit ? h.t : -1.0, h.pos.x, h.pos.y, h.pos.z,
+                                  h.normal.x, h.normal.y, h.normal.z };
+        for (int k = 0; k < 7; ++k) {
+            lua_pushnumber(L, v[k]);
+            lua_rawseti(L, -2, 8*i + k + 1);
+        }
+        lua_pushinteger(L, h.handle);
+        lua_rawseti(L, -2, 8*i + 8);
+    }
+    return 2;
+}
+
 void registerPhysics(lua_State* L) {
     static const luaL_Reg funcs[] = {
-        { "raycast",     l_raycast     },
-        { "sweepSphere", l_sweepSphere },
+        { "raycast",            l_raycast            },
+        { "sweepSphere",        l_sweepSphere        },
+        { "raycastWorld",       l_raycastWorld       },
+        { "sweepSphereWorld",   l_sweepSphereWorld   },
+        { "resolveSphereWorld", l_resolveSphereWorld },
+        { "raycastBatch",       l_raycastBatch       },
         { NULL, NULL }
     };
     luaL_newlib(L, funcs);
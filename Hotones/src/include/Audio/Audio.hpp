@@ -18,31 +18,31 @@ namespace Hotones::Audio {
 
 /// Load a sound file and register it under `name`. Multiple files under the
 /// same name form a playback group (random/sequential selection).
-inline bool LoadSound(const std::string& name, const std::string& path)
+inline bool LoadSound(Hotones::StringId name, const std::string& path)
 {
     return Ho_tones::GetSoundBus().LoadSoundFile(name, path);
 }
 
 /// Play the first loaded variant for `name`.
-inline bool Play(const std::string& name, float gain = 1.0f)
+inline bool Play(Hotones::StringId name, float gain = 1.0f)
 {
     return Ho_tones::GetSoundBus().PlayLoaded(name, gain);
 }
 
 /// Play a random variant from the group for `name`.
-inline bool PlayRandom(const std::string& name, float gain = 1.0f)
+inline bool PlayRandom(Hotones::StringId name, float gain = 1.0f)
 {
     return Ho_tones::GetSoundBus().PlayRandom(name, gain);
 }
 
 /// Play variants in round-robin order (good for footsteps, impacts etc.).
-inline bool PlaySequential(const std::string& name, float gain = 1.0f)
+inline bool PlaySequential(Hotones::StringId name, float gain = 1.0f)
 {
     return Ho_tones::GetSoundBus().PlaySequential(name, gain);
 }
 
 /// Like PlaySequential but each call starts an independent overlapping voice.
-inline bool PlaySequentialAsync(const std::string& name, float gain = 1.0f)
+inline bool PlaySequentialAsync(Hotones::StringId name, float gain = 1.0f)
 {
     return Ho_tones::GetSoundBus().PlaySequentialAsync(name, gain);
 }
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <ECS/Entity.hpp>
+#include <ECS/ComponentType.hpp>
+
+#include <cassert>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Hotones::ECS {
+
+class Registry;
+
+// ---------------------------------------------------------------------------
+// CommandBuffer — records structural changes for later playback.
+//
+// View / Each iterate the live dense arrays of the component pools in place,
+// so adding, removing or destroying while a view is running would shuffle
+// the very arrays being walked. Instead the Registry routes those calls into
+// its CommandBuffer and plays them back once the outermost view returns (or
+// when Registry::Sync() is called).
+//
+// Commands are applied in the order they were recorded. Commands that target
+// an entity which is no longer alive at playback time are dropped.
+//
+// Storage
+// -------
+//   m_commands — one small record per command (entity + playback thunk).
+//   m_staging  — one typed vector per component type holding the values
+//                of pending Add<T> commands, indexed by ComponentType<T>().
+//   Both keep their capacity across flushes, so a steady-state frame does
+//   not allocate.
+//
+// Usage
+// -----
+//   reg.View<HealthComponent>([&](EntityId id, HealthComponent& h) {
+//       if (h.isDead()) reg.DestroyEntity(id);         // deferred automatically
+//       else reg.Commands().Add<LifetimeComponent>(id); // explicit deferral
+//   });
+//   // both commands have been applied here
+//
+// The member functions that need the complete Registry type are defined at
+// the bottom of ECS/Registry.hpp — include that header (or ECS/ECS.hpp).
+// ---------------------------------------------------------------------------
+
+class CommandBuffer {
+public:
+    CommandBuffer()  = default;
+    ~CommandBuffer() = default;
+
+    CommandBuffer(const CommandBuffer&)            = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+    CommandBuffer(CommandBuffer&&)                 = default;
+    CommandBuffer& operator=(CommandBuffer&&)      = default;
+
+    // Record the destruction of entity id.
+    void Destroy(EntityId id);
+
+    // Record "construct a T on id from args". If id already owns a T at
+    // playback time the existing component is replaced.
+    // Returns the staged value so callers can keep filling it in; the
+    // reference is only valid until the next Add<T> on this buffer.
+    template<typename T, typename... Args>
+    T& Add(EntityId id, Args&&... args);
+
+    // Record the removal of T from id.
+    template<typename T>
+    void Remove(EntityId id);
+
+    // Returns the staged value of the most recent pending Add<T> for id,
+    // or nullptr if there is none. Lets callers merge several edits into a
+    // single deferred add instead of having later adds overwrite earlier ones.
+    template<typename T>
+    [[nodiscard]] T* Pending(EntityId id);
+
+    // Apply every recorded command to reg, then reset the buffer.
+    void Flush(Registry& reg);
+
+    // Move every command of other onto the end of this buffer, keeping
+    // their order, and leave other empty. Used to merge the per-chunk
+    // buffers of a parallel iteration into the caller's buffer.
+    void Append(CommandBuffer& other) {
+        assert(&other != this && "CommandBuffer::Append — cannot append a buffer to itself");
+        for (const Command& cmd : other.m_commands)
+            cmd.move(other, *this, cmd.id, cmd.slot);
+        other.Clear();
+    }
+
+    // Drop every recorded command without applying it.
+    void Clear() {
+        m_commands.clear();
+        for (auto& s : m_staging)
+            if (s) s->Clear();
+    }
+
+    [[nodiscard]] bool   Empty() const noexcept { return m_commands.empty(); }
+    [[nodiscard]] size_t Size()  const noexcept { return m_commands.size(); }
+
+private:
+    using ApplyFn = void (*)(Registry&, CommandBuffer&, EntityId, uint32_t);
+    using MoveFn  = void (*)(CommandBuffer& src, CommandBuffer& dst, EntityId, uint32_t);
+
+    struct Command {
+        EntityId id;
+        uint32_t slot;  // index into the typed staging vector (Add only)
+        ApplyFn  apply;
+        MoveFn   move;  // re-records the command into another buffer
+    };
+
+    struct IStaging {
+        virtual ~IStaging() = default;
+        virtual void Clear() = 0;
+    };
+
+    template<typename T>
+    struct Staging : IStaging {
+        std::vector<EntityId> owners; // parallel to values
+        std::vector<T>        values;
+        void Clear() override { owners.clear(); values.clear(); }
+    };
+
+    template<typename T>
+    [[nodiscard]] Staging<T>& StagingFor() {
+        const ComponentTypeId type = ComponentType<T>();
+        if (type >= m_staging.size()) m_staging.resize(type + 1);
+        auto& slot = m_staging[type];
+        if (!slot) slot = std::make_unique<Staging<T>>();
+        return *static_cast<Staging<T>*>(slot.get());
+    }
+
+    static void MoveDestroy(CommandBuffer&, CommandBuffer& dst, EntityId id, uint32_t) {
+        dst.Destroy(id);
+    }
+    template<typename T>
+    static void MoveAdd(CommandBuffer& src, CommandBuffer& dst, EntityId id, uint32_t slot) {
+        dst.Add<T>(id, std::move(src.StagingFor<T>().values[slot]));
+    }
+    template<typename T>
+    static void MoveRemove(CommandBuffer&, CommandBuffer& dst, EntityId id, uint32_t) {
+        dst.Remove<T>(id);
+    }
+
+    static void ApplyDestroy(Registry& reg, CommandBuffer& cb, EntityId id, uint32_t slot);
+    template<typename T>
+    static void ApplyAdd(Registry& reg, CommandBuffer& cb, EntityId id, uint32_t slot);
+    template<typename T>
+    static void ApplyRemove(Registry& reg, CommandBuffer& cb, EntityId id, uint32_t slot);
+
+    std::vector<Command>                   m_commands;
+    std::vector<std::unique_ptr<IStaging>> m_staging;
+};
+
+// ---- Members that do not need the complete Registry ------------------------
+
+inline void CommandBuffer::Destroy(EntityId id) {
+    m_commands.push_back({ id, 0u, &CommandBuffer::ApplyDestroy, &CommandBuffer::MoveDestroy });
+}
+
+template<typename T, typename... Args>
+T& CommandBuffer::Add(EntityId id, Args&&... args) {
+    auto& staging = StagingFor<T>();
+    const uint32_t slot = static_cast<uint32_t>(staging.values.size());
+    staging.owners.push_back(id);
+    staging.values.emplace_back(std::forward<Args>(args)...);
+    m_commands.push_back({ id, slot, &CommandBuffer::ApplyAdd<T>, &CommandBuffer::MoveAdd<T> });
+    return staging.values.back();
+}
+
+template<typename T>
+void CommandBuffer::Remove(EntityId id) {
+    m_commands.push_back({ id, 0u, &CommandBuffer::ApplyRemove<T>, &CommandBuffer::MoveRemove<T> });
+}
+
+template<typename T>
+T* CommandBuffer::Pending(EntityId id) {
+    const ComponentTypeId type = ComponentType<T>();
+    if (type >= m_staging.size() || !m_staging[type]) return nullptr;
+    auto& staging = *static_cast<Staging<T>*>(m_staging[type].get());
+    for (size_t i = staging.owners.size(); i-- > 0;)
+        if (staging.owners[i] == id) return &staging.values[i];
+    return nullptr;
+}
+
+} // namespace Hotones::ECS
@@ -1,11 +1,38 @@
 #pragma once
 
 #include <ECS/Entity.hpp>
+#include <ECS/ComponentType.hpp>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <typeinfo>
+#include <utility>
 #include <vector>
+#include <algorithm>
+#include <cstddef>
 #include <cassert>
 
 namespace Hotones::ECS {
 
+// ---------------------------------------------------------------------------
+// PoolMemoryStats — resident bytes of one component pool.
+//
+// Counts reserved capacity, not just live elements. dataBytes is
+// sizeof(T) × capacity (plus the change ticks of tracked pools); heap
+// memory owned by the components themselves (e.g. the characters of a
+// std::string) is not included.
+// ---------------------------------------------------------------------------
+struct PoolMemoryStats {
+    ComponentTypeId type        = 0;
+    const char*     typeName    = "";  // implementation-defined (typeid name)
+    size_t          count       = 0;   // live components
+    size_t          sparseBytes = 0;   // allocated sparse pages + page table
+    size_t          denseBytes  = 0;   // dense entity-index array
+    size_t          dataBytes   = 0;   // component array (+ change ticks)
+
+    [[nodiscard]] size_t Total() const noexcept { return sparseBytes + denseBytes + dataBytes; }
+};
+
 // ---------------------------------------------------------------------------
 // IPool — type-erased base for ComponentPool<T>.
 //
@@ -26,7 +53,134 @@ struct IPool {
 
     // Dense array of entity indices that own a component in this pool.
     // Returned by const reference — do NOT hold across mutations.
-    virtual const std::vector<uint32_t>& EntityIndices() const = 0;
+    virtual const std::pmr::vector<uint32_t>& EntityIndices() const = 0;
+
+    // Bytes currently held by this pool (see PoolMemoryStats).
+    virtual PoolMemoryStats MemoryStats() const = 0;
+
+    // Type-erased Has(): true if entityIdx owns a component in this pool.
+    virtual bool Contains(uint32_t entityIdx) const = 0;
+
+    // Position of entityIdx in the dense arrays. Entity must own a component.
+    virtual uint32_t DenseIndex(uint32_t entityIdx) const = 0;
+
+    // Exchange two dense positions (entity index and component together),
+    // keeping the sparse array consistent. Used by owning groups.
+    virtual void SwapDense(uint32_t a, uint32_t b) = 0;
+
+    // Reorder dense positions [begin, begin + order.size()) so that
+    // begin + k holds what was at order[k] (a permutation of that range),
+    // keeping the sparse array consistent. Used by Registry::Sort.
+    virtual void Permute(uint32_t begin, std::span<const uint32_t> order) = 0;
+
+    // True while the pool keeps a change tick per element.
+    virtual bool TracksChanges() const = 0;
+
+    // A new, empty pool of the same type on the same memory resource, still
+    // tracking changes if this one does. Used by Registry::ReleaseMemory.
+    virtual std::unique_ptr<IPool> MakeEmpty() const = 0;
+};
+
+namespace detail {
+
+// values[begin + k] = old values[order[k]] for every k: one gather into a
+// scratch array, then a sequential move back.
+template<typename Vec>
+void GatherRange(Vec& values, uint32_t begin, std::span<const uint32_t> order) {
+    std::vector<typename Vec::value_type> gathered;
+    gathered.reserve(order.size());
+    for (const uint32_t from : order) gathered.push_back(std::move(values[from]));
+    std::move(gathered.begin(), gathered.end(), values.begin() + begin);
+}
+
+// Deleter for a Bytes-byte block of T taken from a memory resource.
+template<typename T, size_t Bytes>
+struct ResourceDeleter {
+    std::pmr::memory_resource* resource = nullptr;
+    void operator()(T* p) const noexcept { resource->deallocate(p, Bytes, alignof(T)); }
+};
+
+} // namespace detail
+
+// ---------------------------------------------------------------------------
+// SparseIndex — paged entity index → dense position map shared by the pool
+// types.
+//
+// Split into PAGE_SIZE-entry pages that are allocated on first use and
+// released once no entity in them is mapped, so a rare component costs
+// memory proportional to where its owners live, not to the highest entity
+// index. Pages and the page table come from the pool's memory resource.
+// ---------------------------------------------------------------------------
+class SparseIndex {
+public:
+    static constexpr uint32_t EMPTY     = ~0u;
+    static constexpr uint32_t PAGE_SIZE = 1024u;   // entries per page (4 KiB)
+
+    explicit SparseIndex(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : m_resource(resource), m_pages(resource) {}
+
+    [[nodiscard]] bool Has(uint32_t entityIdx) const {
+        const uint32_t page = entityIdx / PAGE_SIZE;
+        return page < m_pages.size()
+            && m_pages[page].slots
+            && m_pages[page].slots[entityIdx % PAGE_SIZE] != EMPTY;
+    }
+
+    // Slot of an entity whose page is known to exist.
+    [[nodiscard]] uint32_t& Ref(uint32_t entityIdx) {
+        return m_pages[entityIdx / PAGE_SIZE].slots[entityIdx % PAGE_SIZE];
+    }
+    [[nodiscard]] const uint32_t& Ref(uint32_t entityIdx) const {
+        return m_pages[entityIdx / PAGE_SIZE].slots[entityIdx % PAGE_SIZE];
+    }
+
+    // Slot for a new owner; allocates its page on first use.
+    [[nodiscard]] uint32_t& Acquire(uint32_t entityIdx) {
+        const uint32_t page = entityIdx / PAGE_SIZE;
+        if (page >= m_pages.size()) m_pages.resize(page + 1);
+        Page& p = m_pages[page];
+        if (!p.slots) {
+            auto* slots = static_cast<uint32_t*>(m_resource->allocate(PAGE_BYTES, alignof(uint32_t)));
+            p.slots = PagePtr(slots, PageDeleter{ m_resource });
+            std::fill_n(slots, PAGE_SIZE, EMPTY);
+        }
+        ++p.used;
+        return p.slots[entityIdx % PAGE_SIZE];
+    }
+
+    // Unmap an owner; frees its page once nobody uses it and trims
+    // trailing empty entries from the page table.
+    void Release(uint32_t entityIdx) {
+        Ref(entityIdx) = EMPTY;
+        Page& p = m_pages[entityIdx / PAGE_SIZE];
+        if (--p.used != 0) return;
+        p.slots.reset();
+        while (!m_pages.empty() && !m_pages.back().slots) m_pages.pop_back();
+    }
+
+    void Clear() { m_pages.clear(); }
+
+    // Allocated pages + page table.
+    [[nodiscard]] size_t MemoryBytes() const {
+        size_t bytes = m_pages.capacity() * sizeof(Page);
+        for (const auto& page : m_pages)
+            if (page.slots) bytes += PAGE_BYTES;
+        return bytes;
+    }
+
+private:
+    static constexpr size_t PAGE_BYTES = PAGE_SIZE * sizeof(uint32_t);
+
+    using PageDeleter = detail::ResourceDeleter<uint32_t, PAGE_BYTES>;
+    using PagePtr     = std::unique_ptr<uint32_t[], PageDeleter>;
+
+    struct Page {
+        PagePtr  slots;    // null → every entry is EMPTY
+        uint32_t used = 0;
+    };
+
+    std::pmr::memory_resource* m_resource;
+    std::pmr::vector<Page>     m_pages; // pages[idx / PAGE][idx % PAGE] → denseIdx or EMPTY
 };
 
 // ---------------------------------------------------------------------------
@@ -34,9 +188,15 @@ struct IPool {
 //
 // Internals
 // ---------
-//   m_sparse  — indexed by entity index; stores the dense position or EMPTY.
+//   m_sparse  — paged sparse array: entity index → dense position
+//               (see SparseIndex).
 //   m_dense   — packed array of entity indices (parallel to m_data).
 //   m_data    — packed array of T (parallel to m_dense).
+//   m_ticks   — optional change tick per element (parallel to m_data),
+//               kept only once EnableChangeTicks() was called.
+//
+//   All four allocate from the memory resource given at construction (the
+//   owning Registry's MemoryArena).
 //
 // Complexity
 // ----------
@@ -47,12 +207,15 @@ struct IPool {
 template<typename T>
 class ComponentPool : public IPool {
 public:
+    explicit ComponentPool(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : m_sparse(resource), m_dense(resource), m_data(resource), m_ticks(resource) {}
+
     // ---- IPool interface ------------------------------------------------
 
     void Remove(uint32_t entityIdx) override {
         if (!Has(entityIdx)) return;
 
-        const uint32_t denseIdx = m_sparse[entityIdx];
+        const uint32_t denseIdx = m_sparse.Ref(entityIdx);
         const uint32_t last     = static_cast<uint32_t>(m_dense.size()) - 1u;
 
         if (denseIdx != last) {
@@ -60,45 +223,99 @@ public:
             const uint32_t lastEntityIdx = m_dense[last];
             m_dense[denseIdx]            = lastEntityIdx;
             m_data [denseIdx]            = std::move(m_data[last]);
-            m_sparse[lastEntityIdx]      = denseIdx;
+            if (m_tracking) m_ticks[denseIdx] = m_ticks[last];
+            m_sparse.Ref(lastEntityIdx)  = denseIdx;
         }
 
         m_dense.pop_back();
         m_data .pop_back();
-        m_sparse[entityIdx] = EMPTY;
+        if (m_tracking) m_ticks.pop_back();
+        m_sparse.Release(entityIdx);
     }
 
     void Clear() override {
-        m_sparse.clear();
-        m_dense .clear();
-        m_data  .clear();
+        m_sparse.Clear();
+        m_dense.clear();
+        m_data .clear();
+        m_ticks.clear();
     }
 
     [[nodiscard]] size_t Size() const override { return m_dense.size(); }
 
-    [[nodiscard]] const std::vector<uint32_t>& EntityIndices() const override {
+    [[nodiscard]] const std::pmr::vector<uint32_t>& EntityIndices() const override {
         return m_dense;
     }
 
+    [[nodiscard]] PoolMemoryStats MemoryStats() const override {
+        PoolMemoryStats stats;
+        stats.type        = ComponentType<T>();
+        stats.typeName    = typeid(T).name();
+        stats.count       = m_dense.size();
+        stats.sparseBytes = m_sparse.MemoryBytes();
+        stats.denseBytes  = m_dense.capacity() * sizeof(uint32_t);
+        stats.dataBytes   = m_data .capacity() * sizeof(T)
+                          + m_ticks.capacity() * sizeof(uint32_t);
+        return stats;
+    }
+
+    [[nodiscard]] bool Contains(uint32_t entityIdx) const override { return Has(entityIdx); }
+
+    [[nodiscard]] uint32_t DenseIndex(uint32_t entityIdx) const override {
+        assert(Has(entityIdx) && "ComponentPool::DenseIndex — entity does not own this component");
+        return m_sparse.Ref(entityIdx);
+    }
+
+    void SwapDense(uint32_t a, uint32_t b) override {
+        if (a == b) return;
+        using std::swap;
+        swap(m_dense[a], m_dense[b]);
+        swap(m_data [a], m_data [b]);
+        if (m_tracking) swap(m_ticks[a], m_ticks[b]);
+        m_sparse.Ref(m_dense[a]) = a;
+        m_sparse.Ref(m_dense[b]) = b;
+    }
+
+    void Permute(uint32_t begin, std::span<const uint32_t> order) override {
+        detail::GatherRange(m_dense, begin, order);
+        detail::GatherRange(m_data,  begin, order);
+        if (m_tracking) detail::GatherRange(m_ticks, begin, order);
+        const uint32_t end = begin + static_cast<uint32_t>(order.size());
+        for (uint32_t i = begin; i < end; ++i) m_sparse.Ref(m_dense[i]) = i;
+    }
+
+    [[nodiscard]] bool TracksChanges() const noexcept override { return m_tracking; }
+
+    [[nodiscard]] std::unique_ptr<IPool> MakeEmpty() const override {
+        auto pool = std::make_unique<ComponentPool>(m_dense.get_allocator().resource());
+        if (m_tracking) pool->EnableChangeTicks(0u);
+        return pool;
+    }
+
     // ---- Typed interface ------------------------------------------------
 
-    [[nodiscard]] bool Has(uint32_t entityIdx) const {
-        return entityIdx < m_sparse.size() && m_sparse[entityIdx] != EMPTY;
+    [[nodiscard]] bool Has(uint32_t entityIdx) const { return m_sparse.Has(entityIdx); }
+
+    // Make room for n components in total (bulk loads). Grows at least
+    // geometrically, so back-to-back bulk adds stay amortised O(1).
+    void Reserve(size_t n) {
+        if (n <= m_data.capacity()) return;
+        n = std::max(n, m_data.capacity() * 2);
+        m_data .reserve(n);
+        m_dense.reserve(n);
+        if (m_tracking) m_ticks.reserve(n);
     }
 
     // Emplace-construct a T from args directly into the pool.
     // Asserts that the entity does not already own a T.
     template<typename... Args>
     T& Emplace(uint32_t entityIdx, Args&&... args) {
-        if (entityIdx >= m_sparse.size())
-            m_sparse.resize(entityIdx + 1, EMPTY);
-
         assert(!Has(entityIdx) && "ComponentPool::Emplace — entity already owns this component");
 
         const uint32_t denseIdx = static_cast<uint32_t>(m_dense.size());
-        m_sparse[entityIdx]     = denseIdx;
-        m_dense.push_back(entityIdx);
         m_data .emplace_back(std::forward<Args>(args)...);
+        if (m_tracking) m_ticks.push_back(0u);
+        m_dense.push_back(entityIdx);
+        m_sparse.Acquire(entityIdx) = denseIdx;
         return m_data.back();
     }
 
@@ -106,23 +323,62 @@ public:
     // Behaviour is undefined if Has(entityIdx) is false.
     [[nodiscard]] T& Get(uint32_t entityIdx) {
         assert(Has(entityIdx) && "ComponentPool::Get — entity does not own this component");
-        return m_data[m_sparse[entityIdx]];
+        return m_data[m_sparse.Ref(entityIdx)];
     }
     [[nodiscard]] const T& Get(uint32_t entityIdx) const {
         assert(Has(entityIdx) && "ComponentPool::Get — entity does not own this component");
-        return m_data[m_sparse[entityIdx]];
+        return m_data[m_sparse.Ref(entityIdx)];
+    }
+
+    // Get, stamping the element with tick when change ticks are on.
+    [[nodiscard]] T& Write(uint32_t entityIdx, uint32_t tick) {
+        assert(Has(entityIdx) && "ComponentPool::Write — entity does not own this component");
+        const uint32_t denseIdx = m_sparse.Ref(entityIdx);
+        if (m_tracking) m_ticks[denseIdx] = tick;
+        return m_data[denseIdx];
     }
 
     // Access the dense component array directly (for raw iteration).
-    [[nodiscard]] std::vector<T>&       Components()       { return m_data; }
-    [[nodiscard]] const std::vector<T>& Components() const { return m_data; }
+    // Writes made through it are not stamped; see TouchRange.
+    [[nodiscard]] std::pmr::vector<T>&       Components()       { return m_data; }
+    [[nodiscard]] const std::pmr::vector<T>& Components() const { return m_data; }
 
-private:
-    static constexpr uint32_t EMPTY = ~0u;
+    // ---- Change ticks ---------------------------------------------------
+    //
+    // Off by default. Once enabled, every element carries the Registry tick
+    // at which it was last added or handed out mutably (see
+    // Registry::TrackChanges / ViewChanged). Elements present when tracking
+    // is enabled are stamped with tick.
 
-    std::vector<uint32_t> m_sparse; // sparse[entityIdx] → denseIdx or EMPTY
-    std::vector<uint32_t> m_dense;  // dense[i] → entityIdx
-    std::vector<T>        m_data;   // data[i]  → component for dense[i]
+    void EnableChangeTicks(uint32_t tick) {
+        if (m_tracking) return;
+        m_tracking = true;
+        m_ticks.assign(m_data.size(), tick);
+    }
+
+    // Tick array parallel to Components(), or nullptr while tracking is off.
+    [[nodiscard]] uint32_t*       ChangeTicks()       noexcept { return m_tracking ? m_ticks.data() : nullptr; }
+    [[nodiscard]] const uint32_t* ChangeTicks() const noexcept { return m_tracking ? m_ticks.data() : nullptr; }
+
+    // Stamp the element of entityIdx (no-op while tracking is off).
+    void Touch(uint32_t entityIdx, uint32_t tick) {
+        if (m_tracking) m_ticks[m_sparse.Ref(entityIdx)] = tick;
+    }
+
+    // Stamp dense elements [begin, end), e.g. after a raw kernel wrote them.
+    void TouchRange(size_t begin, size_t end, uint32_t tick) {
+        if (m_tracking) std::fill(m_ticks.begin() + begin, m_ticks.begin() + end, tick);
+    }
+
+    // Entries per sparse page (4 KiB of uint32_t).
+    static constexpr uint32_t SPARSE_PAGE_SIZE = SparseIndex::PAGE_SIZE;
+
+private:
+    SparseIndex                 m_sparse; // entityIdx → denseIdx
+    std::pmr::vector<uint32_t>  m_dense; // dense[i] → entityIdx
+    std::pmr::vector<T>         m_data;  // data[i]  → component for dense[i]
+    std::pmr::vector<uint32_t>  m_ticks; // ticks[i] → last change tick of data[i]
+    bool                        m_tracking = false;
 };
 
 } // namespace Hotones::ECS
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <type_traits>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// ComponentTypeId — a small dense integer assigned once per component type.
+//
+// The first call to ComponentType<T>() for a given T hands out the next free
+// id from a process-wide counter; every later call returns the same value.
+// Ids start at 0 and stay dense, so the Registry can index a flat
+// std::vector of pools by them instead of hashing a std::type_index.
+//
+// Ids are NOT stable across runs (they depend on first-use order) — never
+// persist them. cv-qualifiers are stripped, so ComponentType<const T>() and
+// ComponentType<T>() agree.
+// ---------------------------------------------------------------------------
+
+using ComponentTypeId = uint32_t;
+
+// Upper bound on distinct component types per process. Each entity carries a
+// ComponentMask with one bit per type (its "signature").
+inline constexpr uint32_t MAX_COMPONENT_TYPES = 128u;
+
+using ComponentMask = std::bitset<MAX_COMPONENT_TYPES>;
+
+namespace detail {
+    [[nodiscard]] inline ComponentTypeId NextComponentTypeId() noexcept {
+        static std::atomic<ComponentTypeId> s_counter{0u};
+        return s_counter.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    [[nodiscard]] inline ComponentTypeId ComponentTypeOf() noexcept {
+        static const ComponentTypeId s_id = NextComponentTypeId();
+        return s_id;
+    }
+} // namespace detail
+
+// Returns the family id of component type T.
+template<typename T>
+[[nodiscard]] inline ComponentTypeId ComponentType() noexcept {
+    return detail::ComponentTypeOf<std::remove_cv_t<std::remove_reference_t<T>>>();
+}
+
+} // namespace Hotones::ECS
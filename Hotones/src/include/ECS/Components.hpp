@@ -1,8 +1,9 @@
 #pragma once
 
+#include <ECS/Entity.hpp>
+#include <StringId.hpp>
 #include <raylib.h>
 #include <raymath.h>
-#include <string>
 #include <cstdint>
 
 // Forward-declare the heavy Player class so this header stays light.
@@ -13,10 +14,12 @@ namespace Hotones { class Player; }
 //
 // All structs are plain aggregates (no virtual, no heap ownership by default)
 // so they can live directly in the dense component arrays without indirection.
+// Names are interned StringIds rather than std::string, which keeps every
+// built-in component trivially copyable.
 //
 // Add new game-specific components freely in your own headers; you do NOT
-// need to register them anywhere — the Registry discovers them at first use
-// via std::type_index.
+// need to register them anywhere — the Registry assigns each type a
+// ComponentTypeId at first use (see ECS/ComponentType.hpp).
 // ---------------------------------------------------------------------------
 
 namespace Hotones::ECS {
@@ -31,12 +34,18 @@ struct TransformComponent {
     Vector3    scale    = { 1.0f, 1.0f, 1.0f };
 
     /// Convenience: return a Matrix suitable for DrawModelEx / shader uniforms.
+    /// Same result as Scale * Rotation * Translate, composed directly: the
+    /// rotation's basis vectors are scaled and the position written into
+    /// the translation column, with no matrix products.
     [[nodiscard]] Matrix ToMatrix() const {
-        return MatrixMultiply(
-            MatrixMultiply(
-                MatrixScale(scale.x, scale.y, scale.z),
-                QuaternionToMatrix(rotation)),
-            MatrixTranslate(position.x, position.y, position.z));
+        Matrix m = QuaternionToMatrix(rotation);
+        m.m0 *= scale.x;  m.m1 *= scale.x;  m.m2  *= scale.x;
+        m.m4 *= scale.y;  m.m5 *= scale.y;  m.m6  *= scale.y;
+        m.m8 *= scale.z;  m.m9 *= scale.z;  m.m10 *= scale.z;
+        m.m12 = position.x;
+        m.m13 = position.y;
+        m.m14 = position.z;
+        return m;
     }
 };
 
@@ -47,6 +56,7 @@ struct VelocityComponent {
 };
 
 /// Sphere collider — wraps a handle to the PhysicsSystem static mesh.
+/// ScriptedScene unregisters the handle (OnDestroy) when the component goes.
 /// Attach a TransformComponent on the same entity; the physics system reads
 /// and writes back TransformComponent::position after collision resolution.
 struct ColliderSphereComponent {
@@ -56,16 +66,52 @@ struct ColliderSphereComponent {
     bool    isStatic      = false; // if true, the physics system won't move it
 };
 
+// ---- Hierarchy ------------------------------------------------------------
+//
+// Parent / child links between entities. Edit them through the helpers in
+// ECS/Hierarchy.hpp (SetParent, ClearParent, DestroyHierarchy) rather than
+// by hand so both sides stay consistent. The links are plain ids, so all
+// three components are trivially copyable.
+
+/// Link from a child to its parent, plus the child's place in the parent's
+/// sibling list.
+struct ParentComponent {
+    EntityId parent      = INVALID_ENTITY;
+    EntityId prevSibling = INVALID_ENTITY;
+    EntityId nextSibling = INVALID_ENTITY;
+};
+
+/// Head of an entity's child list (siblings are chained through
+/// ParentComponent::nextSibling).
+struct ChildrenComponent {
+    EntityId first = INVALID_ENTITY;
+    uint32_t count = 0;
+};
+
+/// Cached world matrix = local TransformComponent composed with the parent's
+/// world matrix. Maintained by TransformPropagationSystem, which recomputes
+/// it only when the local transform, the parent or an ancestor changed;
+/// read `matrix` instead of calling ToMatrix() yourself.
+struct WorldTransformComponent {
+    Matrix             matrix  = { 1.0f, 0.0f, 0.0f, 0.0f,
+                                   0.0f, 1.0f, 0.0f, 0.0f,
+                                   0.0f, 0.0f, 1.0f, 0.0f,
+                                   0.0f, 0.0f, 0.0f, 1.0f };
+    TransformComponent local   = {};             ///< local transform `matrix` was built from
+    EntityId           parent  = INVALID_ENTITY; ///< parent `matrix` was composed with
+    bool               changed = true;           ///< matrix was rebuilt in the last pass
+};
+
 // ---- Rendering ------------------------------------------------------------
 
 /// Holds a loaded raylib Model handle and render parameters.
 ///
 /// Ownership
 /// ---------
-///   If ownsModel is true the entity "owns" the GPU resources; you are
-///   responsible for calling UnloadModel on the model when the entity is
-///   destroyed (e.g. in a LifetimeSystem or explicit cleanup).
-///   If ownsModel is false the model is shared / managed elsewhere.
+///   If ownsModel is true the entity "owns" the GPU resources. Whoever owns
+///   the registry unloads them from a Registry::OnDestroy handler
+///   (ScriptedScene does) when the component is removed or the entity is
+///   destroyed. If ownsModel is false the model is shared / managed elsewhere.
 struct RenderModelComponent {
     Model model    = {};
     Color tint     = WHITE;
@@ -84,8 +130,9 @@ struct BillboardComponent {
 // ---- Identity / tagging ---------------------------------------------------
 
 /// Human-readable name for the entity (useful for debug UIs / Lua lookups).
+/// ECS::TagIndex finds entities by tag without scanning.
 struct TagComponent {
-    std::string name;
+    StringId name;
 };
 
 /// Attach a compile-time integer tag (group / layer / team) to an entity.
@@ -129,7 +176,7 @@ struct NetworkComponent {
 /// An AudioSystem should read TransformComponent::position each frame to
 /// update the 3-D source position via AudioSystem / SoundBus.
 struct AudioEmitterComponent {
-    std::string soundKey;             // key registered with SoundBus::LoadSoundFile
+    StringId    soundKey;             // key registered with SoundBus::LoadSoundFile
     float       volume    = 1.0f;
     float       pitch     = 1.0f;
     float       maxDist   = 50.0f;
@@ -146,7 +193,7 @@ struct AudioEmitterComponent {
 /// The CupLoader / script system is responsible for calling the Lua methods
 /// on this component each frame.
 struct ScriptComponent {
-    std::string className;      // e.g. "Enemies.Grunt"
+    StringId    className;      // e.g. "Enemies.Grunt"
     int         luaRef  = -1;   // lua_ref into the Lua registry (LUA_NOREF = -1)
     bool        active  = true;
 };
@@ -13,10 +13,27 @@
 // --------
 //
 //   Entity        — uint32_t handle (index + generation)
+//   ComponentType — dense per-type id used to index the Registry's pools
 //   ComponentPool — sparse-set per-component storage  O(1) add/remove/get
+//   SoAPool       — opt-in float-stream storage for all-float components
+//   MemoryArena   — per-Registry memory resource the pools allocate from
 //   Registry      — owns all pools; entity + component lifecycle + queries
+//   CommandBuffer — structural changes recorded during a View, applied after
+//   Signals       — batched OnConstruct / OnUpdate / OnDestroy per component
+//   Prefab        — component template for Registry::Instantiate bulk spawns
 //   System        — virtual base class for per-frame logic
+//   JobSystem     — work-stealing thread pool shared by the ECS
+//   SystemScheduler — runs Systems as a DAG, in parallel where their
+//                   declared component reads / writes allow
 //   Components    — built-in engine component structs
+//   LifetimeSystem — built-in system ticking LifetimeComponent
+//   MortonSortSystem — periodic Z-order sort of Transform and related pools
+//   MovementSystem — built-in SIMD position += velocity * dt
+//   Hierarchy     — SetParent / ClearParent / DestroyHierarchy helpers
+//   Snapshot      — binary full / delta snapshots of a Registry
+//   SpatialIndexSystem — hashed-grid sphere / box / k-nearest queries
+//   TagIndex      — TagComponent name → entities reverse lookup
+//   TransformPropagationSystem — cached world matrices, dirty subtrees only
 //
 // Quick-start
 // -----------
@@ -38,11 +55,28 @@
 //
 //   // 4. Destroy
 //   reg.DestroyEntity(e); // removes ALL components automatically
+//                         // (deferred until the view ends if called inside one)
 //
 // ---------------------------------------------------------------------------
 
 #include <ECS/Entity.hpp>
+#include <ECS/ComponentType.hpp>
 #include <ECS/ComponentPool.hpp>
+#include <ECS/MemoryArena.hpp>
+#include <ECS/SoAPool.hpp>
+#include <ECS/CommandBuffer.hpp>
+#include <ECS/Signals.hpp>
+#include <ECS/Prefab.hpp>
 #include <ECS/Registry.hpp>
 #include <ECS/System.hpp>
+#include <ECS/JobSystem.hpp>
+#include <ECS/SystemScheduler.hpp>
 #include <ECS/Components.hpp>
+#include <ECS/LifetimeSystem.hpp>
+#include <ECS/MortonSortSystem.hpp>
+#include <ECS/MovementSystem.hpp>
+#include <ECS/Hierarchy.hpp>
+#include <ECS/Snapshot.hpp>
+#include <ECS/SpatialIndexSystem.hpp>
+#include <ECS/TagIndex.hpp>
+#include <ECS/TransformPropagationSystem.hpp>
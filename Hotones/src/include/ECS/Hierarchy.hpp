@@ -0,0 +1,226 @@
+#pragma once
+
+#include <ECS/Registry.hpp>
+#include <ECS/Components.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <span>
+#include <vector>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// Transform hierarchy helpers.
+//
+// A child entity owns a ParentComponent; its parent owns a ChildrenComponent
+// heading an intrusive, doubly linked sibling list. Both ends also get a
+// WorldTransformComponent, which TransformPropagationSystem keeps up to date
+// (local transform composed with the parent's world matrix).
+//
+//   EntityId hat = reg.CreateEntity();
+//   reg.AddComponent<TransformComponent>(hat, Vector3{ 0.0f, 1.8f, 0.0f });
+//   SetParent(reg, hat, avatar);
+//   ...
+//   const Matrix& m = reg.GetComponent<WorldTransformComponent>(hat).matrix;
+//
+// Edit the links only through these functions so both sides stay in sync,
+// and destroy whole subtrees with DestroyHierarchy, single entities with
+// DestroyLinked (children become roots). A plain DestroyEntity leaves a dead
+// id in the parent's sibling list until the next sync point, where the
+// observer UnlinkOnDestroy connects (TransformPropagationSystem::Init does)
+// relinks the survivors; until then ForEachChild steps around the gap and
+// the editing functions repair the list they touch.
+// ---------------------------------------------------------------------------
+
+// Give entity a WorldTransformComponent so TransformPropagationSystem
+// maintains its world matrix. Roots without children only need this when
+// callers want the cached matrix. Not allowed inside a View / Each.
+inline WorldTransformComponent& TrackWorldTransform(Registry& reg, EntityId entity) {
+    assert(reg.IsAlive(entity) && "TrackWorldTransform — entity is not alive");
+    return reg.GetOrAdd<WorldTransformComponent>(entity);
+}
+
+namespace detail {
+
+// A sibling link that is set but no longer alive: a child destroyed
+// without being unlinked.
+[[nodiscard]] inline bool DeadLink(const Registry& reg, EntityId link) {
+    return link != INVALID_ENTITY && !reg.IsAlive(link);
+}
+
+// Calls fn(EntityId) for each live entity whose ParentComponent names
+// parent, in pool order.
+template<typename Fn>
+void ScanChildren(const Registry& reg, EntityId parent, Fn&& fn) {
+    const auto* links = reg.PoolPtr<ParentComponent>();
+    if (!links) return;
+    for (const uint32_t idx : links->EntityIndices()) {
+        const EntityId child = reg.EntityAt(idx);
+        if (links->Get(idx).parent == parent) fn(child);
+    }
+}
+
+// Relink parent's sibling list from the ParentComponents that name it,
+// dropping dead ids: the still-reachable head of the list keeps its order,
+// the children cut off behind a dead id follow in pool order.
+inline void RepairChildren(Registry& reg, EntityId parent) {
+    std::vector<EntityId> kids;
+    EntityId child = reg.GetComponent<ChildrenComponent>(parent).first;
+    while (reg.IsAlive(child) && reg.GetComponent<ParentComponent>(child).parent == parent) {
+        kids.push_back(child);
+        child = reg.GetComponent<ParentComponent>(child).nextSibling;
+    }
+    ScanChildren(reg, parent, [&](EntityId e) {
+        if (std::find(kids.begin(), kids.end(), e) == kids.end()) kids.push_back(e);
+    });
+
+    ChildrenComponent& children = reg.GetComponent<ChildrenComponent>(parent);
+    children.first = kids.empty() ? INVALID_ENTITY : kids.front();
+    children.count = static_cast<uint32_t>(kids.size());
+    for (size_t i = 0; i < kids.size(); ++i) {
+        ParentComponent& link = reg.GetComponent<ParentComponent>(kids[i]);
+        link.prevSibling = i > 0               ? kids[i - 1] : INVALID_ENTITY;
+        link.nextSibling = i + 1 < kids.size() ? kids[i + 1] : INVALID_ENTITY;
+    }
+}
+
+// Unlink child from its parent's sibling list. The ParentComponent stays,
+// with its links reset.
+inline void DetachFromParent(Registry& reg, EntityId child) {
+    const EntityId parent = reg.GetComponent<ParentComponent>(child).parent;
+    if (reg.IsAlive(parent) && reg.HasComponent<ChildrenComponent>(parent)) {
+        const ParentComponent& before = reg.GetComponent<ParentComponent>(child);
+        if (DeadLink(reg, before.prevSibling) || DeadLink(reg, before.nextSibling) ||
+            DeadLink(reg, reg.GetComponent<ChildrenComponent>(parent).first))
+            RepairChildren(reg, parent);
+    }
+    ParentComponent& link = reg.GetComponent<ParentComponent>(child);
+    if (reg.IsAlive(parent) && reg.HasComponent<ChildrenComponent>(parent)) {
+        ChildrenComponent& children = reg.GetComponent<ChildrenComponent>(parent);
+        if (reg.IsAlive(link.prevSibling))
+            reg.GetComponent<ParentComponent>(link.prevSibling).nextSibling = link.nextSibling;
+        else
+            children.first = link.nextSibling;
+        if (reg.IsAlive(link.nextSibling))
+            reg.GetComponent<ParentComponent>(link.nextSibling).prevSibling = link.prevSibling;
+        --children.count;
+    }
+    link = ParentComponent{};
+}
+
+} // namespace detail
+
+// Parent of entity, or INVALID_ENTITY for a root.
+[[nodiscard]] inline EntityId GetParent(const Registry& reg, EntityId entity) {
+    if (!reg.HasComponent<ParentComponent>(entity)) return INVALID_ENTITY;
+    const EntityId parent = reg.GetComponent<ParentComponent>(entity).parent;
+    return reg.IsAlive(parent) ? parent : INVALID_ENTITY;
+}
+
+// True if ancestor is entity itself or lies on its parent chain.
+[[nodiscard]] inline bool IsDescendantOf(const Registry& reg, EntityId entity, EntityId ancestor) {
+    for (EntityId up = entity; up != INVALID_ENTITY; up = GetParent(reg, up))
+        if (up == ancestor) return true;
+    return false;
+}
+
+// Calls fn(EntityId) for each live direct child of parent, most recently
+// attached first. Children cut off behind a dead id (destroyed without
+// unlinking, before the next sync point) are found by a scan of the
+// ParentComponent pool instead. fn must not reparent or destroy the children.
+template<typename Fn>
+void ForEachChild(const Registry& reg, EntityId parent, Fn&& fn) {
+    if (!reg.HasComponent<ChildrenComponent>(parent)) return;
+    std::vector<EntityId> seen;
+    EntityId child = reg.GetComponent<ChildrenComponent>(parent).first;
+    while (reg.IsAlive(child)) {
+        const EntityId next = reg.GetComponent<ParentComponent>(child).nextSibling;
+        seen.push_back(child);
+        fn(child);
+        child = next;
+    }
+    if (!detail::DeadLink(reg, child)) return;
+    detail::ScanChildren(reg, parent, [&](EntityId e) {
+        if (std::find(seen.begin(), seen.end(), e) == seen.end()) fn(e);
+    });
+}
+
+// Attach child under parent, detaching it from any previous parent. The
+// child keeps its local TransformComponent, which from now on is relative
+// to the parent. Asserts parent is not child itself or one of its
+// descendants. Not allowed inside a View / Each.
+inline void SetParent(Registry& reg, EntityId child, EntityId parent) {
+    assert(!reg.IsIterating() && "SetParent — not allowed inside a View / Each");
+    assert(reg.IsAlive(child) && reg.IsAlive(parent) && "SetParent — entity is not alive");
+    assert(!IsDescendantOf(reg, parent, child) && "SetParent — would create a cycle");
+
+    // Add everything first: adding may move components already fetched.
+    TrackWorldTransform(reg, parent);
+    TrackWorldTransform(reg, child);
+    reg.GetOrAdd<ChildrenComponent>(parent);
+    reg.GetOrAdd<ParentComponent>(child);
+
+    detail::DetachFromParent(reg, child);
+    if (detail::DeadLink(reg, reg.GetComponent<ChildrenComponent>(parent).first))
+        detail::RepairChildren(reg, parent);
+
+    ChildrenComponent& children = reg.GetComponent<ChildrenComponent>(parent);
+    ParentComponent&   link     = reg.GetComponent<ParentComponent>(child);
+    link.parent      = parent;
+    link.nextSibling = children.first;
+    if (reg.IsAlive(children.first))
+        reg.GetComponent<ParentComponent>(children.first).prevSibling = child;
+    children.first = child;
+    ++children.count;
+}
+
+// Make entity a root again. Its local transform is kept, so it jumps to
+// where that transform puts it in world space. Not allowed inside a
+// View / Each.
+inline void ClearParent(Registry& reg, EntityId entity) {
+    assert(!reg.IsIterating() && "ClearParent — not allowed inside a View / Each");
+    if (!reg.IsAlive(entity) || !reg.HasComponent<ParentComponent>(entity)) return;
+    detail::DetachFromParent(reg, entity);
+    reg.RemoveComponent<ParentComponent>(entity);
+}
+
+// Destroy root and all of its descendants. Inside a View / Each the
+// destruction itself is deferred like DestroyEntity.
+inline void DestroyHierarchy(Registry& reg, EntityId root) {
+    if (!reg.IsAlive(root)) return;
+    if (reg.HasComponent<ParentComponent>(root)) detail::DetachFromParent(reg, root);
+
+    std::vector<EntityId> subtree{ root };
+    for (size_t i = 0; i < subtree.size(); ++i)
+        ForEachChild(reg, subtree[i], [&](EntityId child) { subtree.push_back(child); });
+    reg.DestroyEntities(subtree);
+}
+
+// Destroy entity, unlinking it from its parent's sibling list first so the
+// list is exact at once; its children become roots. Inside a View / Each
+// the destruction itself is deferred like DestroyEntity.
+inline void DestroyLinked(Registry& reg, EntityId entity) {
+    if (!reg.IsAlive(entity)) return;
+    if (reg.HasComponent<ParentComponent>(entity)) detail::DetachFromParent(reg, entity);
+    reg.DestroyEntity(entity);
+}
+
+// Connect an OnDestroy<ParentComponent> observer that relinks the sibling
+// lists of parents whose children were destroyed without unlinking, at the
+// next sync point. Disconnect the returned connection when done.
+inline SignalConnection UnlinkOnDestroy(Registry& reg) {
+    return reg.OnDestroy<ParentComponent>(
+        [](Registry& r, std::span<const EntityId>, std::span<ParentComponent> links) {
+            std::vector<EntityId> parents;
+            for (const ParentComponent& link : links)
+                if (link.parent != INVALID_ENTITY &&
+                    std::find(parents.begin(), parents.end(), link.parent) == parents.end())
+                    parents.push_back(link.parent);
+            for (const EntityId parent : parents)
+                if (r.IsAlive(parent) && r.HasComponent<ChildrenComponent>(parent))
+                    detail::RepairChildren(r, parent);
+        });
+}
+
+} // namespace Hotones::ECS
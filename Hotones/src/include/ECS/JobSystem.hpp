@@ -0,0 +1,191 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// JobSystem — a small work-stealing thread pool.
+//
+// Every worker owns a deque. A job submitted FROM a worker goes onto that
+// worker's own deque and is popped LIFO (hot in cache); idle workers steal
+// FIFO from the other end of their siblings' deques. Jobs submitted from any
+// other thread land in a shared injection queue that every worker drains.
+//
+// Jobs are grouped by a Counter. Wait(counter) does not block: the waiting
+// thread keeps running queued jobs until the counter drops to zero, so the
+// main thread contributes a core instead of idling.
+//
+// Usage
+// -----
+//   JobSystem::Counter done;
+//   auto& jobs = JobSystem::Get();
+//   for (auto& chunk : chunks)
+//       jobs.Submit([&chunk] { Process(chunk); }, done);
+//   jobs.Wait(done);
+//
+// Jobs must not throw. A job may Submit further jobs (to any counter) and
+// may Wait on a counter of its own.
+// ---------------------------------------------------------------------------
+
+class JobSystem {
+public:
+    using Job = std::function<void()>;
+
+    // Number of jobs of a batch still queued or running.
+    struct Counter {
+        std::atomic<uint32_t> pending{0u};
+        [[nodiscard]] bool Done() const noexcept {
+            return pending.load(std::memory_order_acquire) == 0u;
+        }
+    };
+
+    // Spawns workerCount threads (at least one).
+    explicit JobSystem(unsigned workerCount = DefaultWorkerCount())
+        : m_workerCount(workerCount > 0 ? workerCount : 1)
+    {
+        m_queues.reserve(m_workerCount + 1);
+        for (unsigned i = 0; i <= m_workerCount; ++i)   // last one: injection queue
+            m_queues.push_back(std::make_unique<Queue>());
+        m_workers.reserve(m_workerCount);
+        for (unsigned i = 0; i < m_workerCount; ++i)
+            m_workers.emplace_back([this, i] { WorkerLoop(i); });
+    }
+
+    // Runs every job still queued, then joins the workers.
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_running = false;
+        }
+        m_wake.notify_all();
+        for (auto& t : m_workers) t.join();
+    }
+
+    JobSystem(const JobSystem&)            = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Process-wide pool shared by the SystemScheduler and the Registry's
+    // parallel iteration. Created on first use.
+    [[nodiscard]] static JobSystem& Get() {
+        static JobSystem s_instance;
+        return s_instance;
+    }
+
+    // One worker per hardware thread, leaving one for the thread that waits.
+    [[nodiscard]] static unsigned DefaultWorkerCount() noexcept {
+        const unsigned hw = std::thread::hardware_concurrency();
+        return hw > 1 ? hw - 1 : 1;
+    }
+
+    [[nodiscard]] unsigned WorkerCount() const noexcept { return m_workerCount; }
+
+    // Queue job and count it against counter.
+    void Submit(Job job, Counter& counter) {
+        counter.pending.fetch_add(1u, std::memory_order_acq_rel);
+        // Count before publishing so a thief can never decrement below zero.
+        m_queued.fetch_add(1u, std::memory_order_release);
+        Queue& q = (t_owner == this) ? *m_queues[t_worker] : *m_queues.back();
+        {
+            std::lock_guard<std::mutex> lock(q.mutex);
+            q.jobs.push_back({ std::move(job), &counter });
+        }
+        // Taking the sleep mutex orders this notify after a worker's
+        // predicate check, so the wake-up cannot be lost.
+        { std::lock_guard<std::mutex> lock(m_sleepMutex); }
+        m_wake.notify_one();
+    }
+
+    // Run queued jobs on the calling thread until counter reaches zero.
+    void Wait(Counter& counter) {
+        const unsigned self = ThreadIndex();
+        while (!counter.Done())
+            if (!TryRunOne(self)) std::this_thread::yield();
+    }
+
+    // Index of the calling thread in this pool: [0, WorkerCount()) for a
+    // worker, WorkerCount() for any other thread.
+    [[nodiscard]] unsigned ThreadIndex() const noexcept {
+        return (t_owner == this) ? t_worker : WorkerCount();
+    }
+
+private:
+    struct Task {
+        Job      fn;
+        Counter* counter;
+    };
+
+    struct Queue {
+        std::mutex       mutex;
+        std::deque<Task> jobs;
+    };
+
+    // Pop from the own deque (back), then the injection queue, then steal
+    // from the front of the other workers' deques.
+    bool TryRunOne(unsigned self) {
+        Task task;
+        const unsigned workers = WorkerCount();
+        bool found = self < workers && PopBack(*m_queues[self], task);
+        if (!found) found = PopFront(*m_queues.back(), task);
+        for (unsigned i = 1; !found && i <= workers; ++i)
+            found = PopFront(*m_queues[(self + i) % workers], task);
+        if (!found) return false;
+
+        m_queued.fetch_sub(1u, std::memory_order_relaxed);
+        task.fn();
+        task.counter->pending.fetch_sub(1u, std::memory_order_release);
+        return true;
+    }
+
+    static bool PopBack(Queue& q, Task& out) {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.jobs.empty()) return false;
+        out = std::move(q.jobs.back());
+        q.jobs.pop_back();
+        return true;
+    }
+
+    static bool PopFront(Queue& q, Task& out) {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.jobs.empty()) return false;
+        out = std::move(q.jobs.front());
+        q.jobs.pop_front();
+        return true;
+    }
+
+    void WorkerLoop(unsigned index) {
+        t_owner  = this;
+        t_worker = index;
+        for (;;) {
+            if (TryRunOne(index)) continue;
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_wake.wait(lock, [this] {
+                return !m_running || m_queued.load(std::memory_order_acquire) > 0;
+            });
+            if (!m_running && m_queued.load(std::memory_order_acquire) == 0) return;
+        }
+    }
+
+    // Identifies the pool (if any) the current thread works for.
+    static inline thread_local const JobSystem* t_owner  = nullptr;
+    static inline thread_local unsigned         t_worker = 0;
+
+    const unsigned                      m_workerCount;
+    std::vector<std::unique_ptr<Queue>> m_queues;   // one per worker + injection queue
+    std::vector<std::thread>            m_workers;
+    std::atomic<uint32_t>               m_queued{0u}; // jobs sitting in any queue
+    std::mutex                          m_sleepMutex;
+    std::condition_variable             m_wake;
+    bool                                m_running = true; // guarded by m_sleepMutex
+};
+
+} // namespace Hotones::ECS
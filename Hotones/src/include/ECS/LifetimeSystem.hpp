@@ -0,0 +1,35 @@
+#pragma once
+
+#include <ECS/System.hpp>
+#include <ECS/Registry.hpp>
+#include <ECS/Components.hpp>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// LifetimeSystem — counts LifetimeComponent::remaining down by dt and
+// destroys the entity when it reaches zero.
+//
+// Only writes LifetimeComponent; destruction is structural but deferred, so
+// the system may run in parallel with anything that leaves lifetimes alone.
+// Destroyed entities disappear when the scheduler's parallel batch ends.
+// The countdown itself is chunked across workers with ParallelEach.
+// ---------------------------------------------------------------------------
+
+class LifetimeSystem : public System {
+public:
+    void DeclareAccess(SystemAccess& access) const override {
+        access.Writes<LifetimeComponent>();
+    }
+
+    void Update(Registry& reg, float dt) override {
+        reg.ParallelEach<LifetimeComponent>([&](EntityId id, LifetimeComponent& lt) {
+            lt.remaining -= dt;
+            if (lt.remaining <= 0.0f) reg.DestroyEntity(id);
+        });
+    }
+
+    [[nodiscard]] const char* Name() const override { return "LifetimeSystem"; }
+};
+
+} // namespace Hotones::ECS
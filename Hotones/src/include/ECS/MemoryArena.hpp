@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// MemoryArena — the memory resource a Registry's component pools allocate
+// their sparse pages, dense / data arrays and change ticks from.
+//
+//   pools → size-class free lists → monotonic chunks → heap
+//
+// Blocks up to LARGEST_POOLED_BLOCK (sparse pages, small pools) are recycled
+// through the free lists, so churn does not grow the arena. Larger blocks
+// (the arrays of big pools) are carved from chunks that grow geometrically
+// from the initial size; a pool that outgrows its buffer leaves the old one
+// behind until Reset(). Reserve hints (Registry::Reserve<T>) avoid that.
+//
+// Reset() hands every chunk back to the heap in one go. It must only be
+// called once nothing allocated from the arena is alive — which is what
+// Registry::ReleaseMemory arranges. Not thread-safe, like the Registry.
+// ---------------------------------------------------------------------------
+class MemoryArena final : public std::pmr::memory_resource {
+public:
+    // Largest block served from the recycling free lists.
+    static constexpr size_t LARGEST_POOLED_BLOCK = 64 * 1024;
+
+    // initialBytes sizes the first chunk taken from the heap (0: a small
+    // default). It is taken up front, so a sized arena serves a whole level
+    // from one heap allocation.
+    explicit MemoryArena(size_t initialBytes = 0) { Build(initialBytes); }
+
+    MemoryArena(const MemoryArena&)            = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    // Release every chunk and start over with a first chunk of initialBytes.
+    // Peak statistics restart as well.
+    void Reset(size_t initialBytes = 0) {
+        m_pools.reset();
+        m_chunks.reset();
+        m_inUse = 0;
+        m_peak  = 0;
+        Build(initialBytes);
+    }
+
+    // Bytes currently allocated by pools.
+    [[nodiscard]] size_t BytesInUse() const noexcept { return m_inUse; }
+
+    // Highest BytesInUse() since construction or the last Reset().
+    [[nodiscard]] size_t PeakBytes() const noexcept { return m_peak; }
+
+    // Bytes the arena holds from the heap (in use, free-listed or not yet
+    // handed out).
+    [[nodiscard]] size_t ReservedBytes() const noexcept { return m_heap.bytes; }
+
+    // First-chunk size the arena was built or last reset with.
+    [[nodiscard]] size_t InitialBytes() const noexcept { return m_initial; }
+
+private:
+    // Upstream of the chunk resource: the heap, with a byte count.
+    struct HeapCounter final : std::pmr::memory_resource {
+        size_t bytes = 0;
+
+        void* do_allocate(size_t size, size_t align) override {
+            void* p = std::pmr::new_delete_resource()->allocate(size, align);
+            bytes += size;
+            return p;
+        }
+        void do_deallocate(void* p, size_t size, size_t align) override {
+            std::pmr::new_delete_resource()->deallocate(p, size, align);
+            bytes -= size;
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    void Build(size_t initialBytes) {
+        m_initial = initialBytes;
+        if (initialBytes) m_chunks.emplace(initialBytes, &m_heap);
+        else              m_chunks.emplace(&m_heap);
+        std::pmr::pool_options options;
+        options.largest_required_pool_block = LARGEST_POOLED_BLOCK;
+        m_pools.emplace(options, &*m_chunks);
+    }
+
+    void* do_allocate(size_t size, size_t align) override {
+        void* p = m_pools->allocate(size, align);
+        m_inUse += size;
+        m_peak   = std::max(m_peak, m_inUse);
+        return p;
+    }
+
+    void do_deallocate(void* p, size_t size, size_t align) override {
+        m_pools->deallocate(p, size, align);
+        m_inUse -= size;
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    HeapCounter                                            m_heap;
+    std::optional<std::pmr::monotonic_buffer_resource>     m_chunks;
+    std::optional<std::pmr::unsynchronized_pool_resource>  m_pools;
+    size_t                                                 m_inUse   = 0;
+    size_t                                                 m_peak    = 0;
+    size_t                                                 m_initial = 0;
+};
+
+} // namespace Hotones::ECS
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <ECS/System.hpp>
+#include <ECS/Registry.hpp>
+#include <ECS/Components.hpp>
+
+#include <cmath>
+#include <cstdint>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// MortonSortSystem — periodically sorts the TransformComponent pool by the
+// Morton (Z-order) code of each position, then makes the other per-object
+// pools (WorldTransform, Velocity, ColliderSphere, RenderModel) follow the
+// same order.
+//
+//   systems.Add<MortonSortSystem>();          // last: it runs alone
+//   systems.Add<MortonSortSystem>(0.5f, 4.0f);
+//
+// After churn (destroy / create / add / remove all swap-remove) pool order
+// is effectively random, so a View that touches neighbours — rendering, the
+// spatial index refile, collision passes — jumps around memory. Z-order
+// keeps entities that are close in space close in the dense arrays, and
+// SortAs lines the followers up with Transform so multi-pool views walk
+// every array forward.
+//
+// Positions are quantised to cells of `cellSize` world units (21 bits per
+// axis, ±2^20 cells around the origin; beyond that they clamp). A pass runs
+// every `interval` seconds; it is skipped outright when the keys are already
+// in order, otherwise it costs an O(n log n) sort plus one O(n) pass per
+// follower. Entity ids and component values never change, so index
+// structures keyed by EntityId (SpatialIndexSystem, TagIndex,
+// TransformPropagationSystem) are unaffected.
+//
+// Reordering pools is structural, so the system is Exclusive: the scheduler
+// runs it on its own, between the parallel phases.
+// ---------------------------------------------------------------------------
+
+class MortonSortSystem : public System {
+public:
+    explicit MortonSortSystem(float interval = 1.0f, float cellSize = 1.0f) noexcept
+        : m_interval(interval), m_invCell(1.0f / cellSize) {}
+
+    void DeclareAccess(SystemAccess& access) const override { access.Exclusive(); }
+
+    void Update(Registry& reg, float dt) override {
+        m_elapsed += dt;
+        if (m_elapsed < m_interval) return;
+        m_elapsed = 0.0f;
+        SortNow(reg);
+    }
+
+    // Run a pass immediately, e.g. right after loading a level.
+    void SortNow(Registry& reg) {
+        reg.SortByKey<TransformComponent>([this](const TransformComponent& t) { return Key(t.position); });
+        reg.SortAs<WorldTransformComponent, TransformComponent>();
+        reg.SortAs<VelocityComponent,       TransformComponent>();
+        reg.SortAs<ColliderSphereComponent, TransformComponent>();
+        reg.SortAs<RenderModelComponent,    TransformComponent>();
+    }
+
+    [[nodiscard]] const char* Name() const override { return "MortonSortSystem"; }
+
+private:
+    static constexpr uint32_t AXIS_BITS = 21;
+    static constexpr uint32_t AXIS_MAX  = (1u << AXIS_BITS) - 1u;
+    static constexpr float    AXIS_BIAS = static_cast<float>(1u << (AXIS_BITS - 1u));
+
+    // Cell coordinate of v on one axis, biased to be unsigned. NaN maps to 0.
+    [[nodiscard]] uint32_t Quantise(float v) const noexcept {
+        const float q = std::floor(v * m_invCell) + AXIS_BIAS;
+        if (!(q > 0.0f)) return 0u;
+        return q < static_cast<float>(AXIS_MAX) ? static_cast<uint32_t>(q) : AXIS_MAX;
+    }
+
+    // Spread the low 21 bits of v so that bit i lands at bit 3i.
+    [[nodiscard]] static uint64_t Spread(uint64_t v) noexcept {
+        v &= AXIS_MAX;
+        v = (v | v << 32) & 0x001f00000000ffffull;
+        v = (v | v << 16) & 0x001f0000ff0000ffull;
+        v = (v | v << 8)  & 0x100f00f00f00f00full;
+        v = (v | v << 4)  & 0x10c30c30c30c30c3ull;
+        v = (v | v << 2)  & 0x1249249249249249ull;
+        return v;
+    }
+
+    [[nodiscard]] uint64_t Key(const Vector3& p) const noexcept {
+        return Spread(Quantise(p.x)) | Spread(Quantise(p.y)) << 1 | Spread(Quantise(p.z)) << 2;
+    }
+
+    float m_interval;
+    float m_invCell;
+    float m_elapsed = 0.0f;
+};
+
+} // namespace Hotones::ECS
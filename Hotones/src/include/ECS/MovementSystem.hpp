@@ -0,0 +1,146 @@
+#pragma once
+
+#include <ECS/System.hpp>
+#include <ECS/Registry.hpp>
+#include <ECS/Components.hpp>
+#include <ECS/JobSystem.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define HOTONES_ECS_SSE 1
+    #include <immintrin.h>
+#endif
+#if defined(__AVX__)
+    #define HOTONES_ECS_AVX 1
+#endif
+
+namespace Hotones::ECS {
+
+namespace detail {
+
+// p[i] += v[i] * dt for i in [0, n). 8 lanes with AVX, 4 with SSE, then a
+// scalar tail (or scalar throughout on other targets).
+inline void MulAddStream(float* p, const float* v, float dt, size_t n) {
+    size_t i = 0;
+#if HOTONES_ECS_AVX
+    const __m256 d8 = _mm256_set1_ps(dt);
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(p + i, _mm256_add_ps(_mm256_loadu_ps(p + i),
+                                              _mm256_mul_ps(_mm256_loadu_ps(v + i), d8)));
+#endif
+#if HOTONES_ECS_SSE
+    const __m128 d4 = _mm_set1_ps(dt);
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(p + i, _mm_add_ps(_mm_loadu_ps(p + i),
+                                        _mm_mul_ps(_mm_loadu_ps(v + i), d4)));
+#endif
+    for (; i < n; ++i) p[i] += v[i] * dt;
+}
+
+// position += linear * dt over n lock-step Transform / Velocity pairs.
+//
+// The components are AoS, so the SSE path does one entity per register:
+// it loads position.xyz plus the following rotation.x, and writes lane 3
+// back unchanged.
+inline void IntegrateLinear(TransformComponent* t, const VelocityComponent* v, size_t n, float dt) {
+#if HOTONES_ECS_SSE
+    static_assert(offsetof(TransformComponent, position) + 4 * sizeof(float) <= sizeof(TransformComponent)
+               && offsetof(VelocityComponent, linear) + 4 * sizeof(float) <= sizeof(VelocityComponent),
+                  "IntegrateLinear reads four floats from position / linear");
+    const __m128 d   = _mm_set1_ps(dt);
+    const __m128 xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+    for (size_t i = 0; i < n; ++i) {
+        float*       p  = &t[i].position.x;
+        const __m128 pv = _mm_loadu_ps(p);
+        const __m128 s  = _mm_add_ps(pv, _mm_mul_ps(_mm_loadu_ps(&v[i].linear.x), d));
+        _mm_storeu_ps(p, _mm_or_ps(_mm_and_ps(xyz, s), _mm_andnot_ps(xyz, pv)));
+    }
+#else
+    for (size_t i = 0; i < n; ++i) {
+        t[i].position.x += v[i].linear.x * dt;
+        t[i].position.y += v[i].linear.y * dt;
+        t[i].position.z += v[i].linear.z * dt;
+    }
+#endif
+}
+
+} // namespace detail
+
+// Integrate SoA position streams: p += v * dt, n entries per stream. For
+// components stored with UseSoAStorage (see ECS/SoAPool.hpp).
+inline void IntegrateStreams(float* px, float* py, float* pz,
+                             const float* vx, const float* vy, const float* vz,
+                             size_t n, float dt) {
+    detail::MulAddStream(px, vx, dt, n);
+    detail::MulAddStream(py, vy, dt, n);
+    detail::MulAddStream(pz, vz, dt, n);
+}
+
+// ---------------------------------------------------------------------------
+// MovementSystem — TransformComponent::position += VelocityComponent::linear
+// * dt for every entity that has both. Angular velocity is left to gameplay
+// code.
+//
+// Init() takes an owning group over Transform / Velocity, so movers sit
+// packed at the front of both pools and Update() is a straight SIMD pass
+// over the two arrays (SSE, scalar elsewhere), split across the JobSystem
+// when large. Because the group owns both pools, no other group may own
+// TransformComponent or VelocityComponent. Without Init() the system falls
+// back to a plain View.
+//
+// Transform and Velocity stay AoS: the engine and the Lua bindings hand out
+// TransformComponent& / VelocityComponent&, which SoA storage cannot do.
+// The streams kernel (IntegrateStreams) is there for SoA components.
+//
+// Not registered by default: the Lua API documents that velocity is not
+// integrated automatically. Scenes that want it add it to their scheduler.
+// ---------------------------------------------------------------------------
+
+class MovementSystem : public System {
+public:
+    // Movers per job when the pass is split across workers.
+    static constexpr size_t CHUNK = 16384;
+
+    void DeclareAccess(SystemAccess& access) const override {
+        access.Reads<VelocityComponent>().Writes<TransformComponent>();
+    }
+
+    void Init(Registry& reg) override {
+        m_movers.emplace(reg.Group<TransformComponent, VelocityComponent>());
+    }
+
+    void Shutdown(Registry&) override { m_movers.reset(); }
+
+    void Update(Registry& reg, float dt) override {
+        if (!m_movers) {
+            reg.View<TransformComponent, const VelocityComponent>(
+                [dt](EntityId, TransformComponent& t, const VelocityComponent& v) {
+                    detail::IntegrateLinear(&t, &v, 1, dt);
+                });
+            return;
+        }
+
+        TransformComponent*      t = m_movers->Data<TransformComponent>();
+        const VelocityComponent* v = m_movers->Data<const VelocityComponent>();
+        const size_t             n = m_movers->Size();
+        if (n <= CHUNK) { detail::IntegrateLinear(t, v, n, dt); return; }
+
+        JobSystem& jobs = JobSystem::Get();
+        JobSystem::Counter done;
+        for (size_t begin = 0; begin < n; begin += CHUNK) {
+            const size_t count = std::min(CHUNK, n - begin);
+            jobs.Submit([=] { detail::IntegrateLinear(t + begin, v + begin, count, dt); }, done);
+        }
+        jobs.Wait(done);
+    }
+
+    [[nodiscard]] const char* Name() const override { return "MovementSystem"; }
+
+private:
+    std::optional<OwningGroup<TransformComponent, VelocityComponent>> m_movers;
+};
+
+} // namespace Hotones::ECS
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <ECS/Entity.hpp>
+#include <ECS/ComponentType.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Hotones::ECS {
+
+class Registry;
+class CommandBuffer;
+
+namespace detail {
+
+// One component value of a Prefab, type-erased.
+struct IPrefabComponent {
+    virtual ~IPrefabComponent() = default;
+
+    [[nodiscard]] virtual ComponentTypeId Type() const = 0;
+    [[nodiscard]] virtual std::unique_ptr<IPrefabComponent> Clone() const = 0;
+
+    // Give every entity of ids a copy of the value (Registry::AddComponents).
+    virtual void Construct(Registry& reg, std::span<const EntityId> ids) const = 0;
+
+    // Same, recorded into cb for playback after the current view.
+    virtual void Defer(CommandBuffer& cb, std::span<const EntityId> ids) const = 0;
+};
+
+template<typename T>
+struct PrefabComponent final : IPrefabComponent {
+    explicit PrefabComponent(T v) : value(std::move(v)) {}
+
+    [[nodiscard]] ComponentTypeId Type() const override { return ComponentType<T>(); }
+    [[nodiscard]] std::unique_ptr<IPrefabComponent> Clone() const override {
+        return std::make_unique<PrefabComponent<T>>(value);
+    }
+    void Construct(Registry& reg, std::span<const EntityId> ids) const override;  // defined after Registry
+    void Defer(CommandBuffer& cb, std::span<const EntityId> ids) const override;  // defined after Registry
+
+    T value;
+};
+
+} // namespace detail
+
+// ---------------------------------------------------------------------------
+// Prefab — a set of component values to stamp onto new entities.
+//
+//   Prefab spark;
+//   spark.Set<TransformComponent>().scale = { 0.1f, 0.1f, 0.1f };
+//   spark.Set<VelocityComponent>(VelocityComponent{ { 0.0f, 4.0f, 0.0f } });
+//   spark.Set<LifetimeComponent>(LifetimeComponent{ 0.5f });
+//
+//   std::vector<EntityId> burst = reg.Instantiate(spark, 2000);
+//
+// Registry::Instantiate creates the entities in one go, then fills the
+// pools one component type at a time: each pool grows once and is appended
+// to in a tight loop, instead of every entity visiting every pool.
+//
+// A prefab is a plain value, independent of any Registry: it can be built
+// once at load time and instantiated into several worlds. FromEntity copies
+// selected components off an existing "template" entity.
+//
+// Components are copied as-is, so only put in types whose copies are
+// independent (no owned GPU / physics handles, no Lua references).
+// ---------------------------------------------------------------------------
+
+class Prefab {
+public:
+    Prefab() = default;
+    Prefab(Prefab&&) noexcept            = default;
+    Prefab& operator=(Prefab&&) noexcept = default;
+
+    Prefab(const Prefab& other) { *this = other; }
+    Prefab& operator=(const Prefab& other) {
+        if (this == &other) return *this;
+        m_components.clear();
+        m_components.reserve(other.m_components.size());
+        for (const auto& c : other.m_components) m_components.push_back(c->Clone());
+        return *this;
+    }
+
+    // Set (add or replace) the T stamped onto instances; returns it for
+    // further editing.
+    template<typename T>
+    T& Set(T value = T{}) {
+        if (auto* slot = Find<T>()) { slot->value = std::move(value); return slot->value; }
+        auto component = std::make_unique<detail::PrefabComponent<T>>(std::move(value));
+        T& ref = component->value;
+        m_components.push_back(std::move(component));
+        return ref;
+    }
+
+    template<typename T>
+    [[nodiscard]] bool Has() const { return Find<T>() != nullptr; }
+
+    // Asserts the prefab has a T.
+    template<typename T>
+    [[nodiscard]] T& Get() {
+        assert(Has<T>() && "Prefab::Get — prefab has no such component");
+        return Find<T>()->value;
+    }
+    template<typename T>
+    [[nodiscard]] const T& Get() const {
+        assert(Has<T>() && "Prefab::Get — prefab has no such component");
+        return Find<T>()->value;
+    }
+
+    template<typename T>
+    void Remove() {
+        const ComponentTypeId type = ComponentType<T>();
+        std::erase_if(m_components, [type](const auto& c) { return c->Type() == type; });
+    }
+
+    [[nodiscard]] size_t ComponentCount() const noexcept { return m_components.size(); }
+    [[nodiscard]] bool   Empty()          const noexcept { return m_components.empty(); }
+
+    // Prefab holding a copy of each of Ts that entity owns.
+    template<typename... Ts>
+    [[nodiscard]] static Prefab FromEntity(const Registry& reg, EntityId entity);  // defined after Registry
+
+private:
+    friend class Registry;
+
+    template<typename T>
+    [[nodiscard]] detail::PrefabComponent<T>* Find() const {
+        const ComponentTypeId type = ComponentType<T>();
+        for (const auto& c : m_components)
+            if (c->Type() == type) return static_cast<detail::PrefabComponent<T>*>(c.get());
+        return nullptr;
+    }
+
+    std::vector<std::unique_ptr<detail::IPrefabComponent>> m_components;
+};
+
+} // namespace Hotones::ECS
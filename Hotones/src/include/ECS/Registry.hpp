@@ -1,29 +1,110 @@
 #pragma once
 
 #include <ECS/Entity.hpp>
+#include <ECS/ComponentType.hpp>
 #include <ECS/ComponentPool.hpp>
+#include <ECS/MemoryArena.hpp>
+#include <ECS/SoAPool.hpp>
+#include <ECS/CommandBuffer.hpp>
+#include <ECS/JobSystem.hpp>
+#include <ECS/Signals.hpp>
+#include <ECS/Prefab.hpp>
 
-#include <typeindex>
-#include <typeinfo>
-#include <unordered_map>
+#include <atomic>
 #include <memory>
+#include <numeric>
+#include <span>
 #include <vector>
 #include <queue>
+#include <tuple>
+#include <type_traits>
 #include <algorithm>
 #include <cassert>
 
 namespace Hotones::ECS {
 
+template<typename... Ts> class OwningGroup;
+class SystemScheduler;
+
+namespace detail {
+
+// ---------------------------------------------------------------------------
+// GroupData — type-erased bookkeeping of one owning group.
+//
+// The group owns the dense arrays of its pools: every entity that has ALL
+// of the owned component types is kept in the first `size` slots of each
+// pool, at the SAME dense index in every pool. Iterating the group is then
+// a lock-step walk over [0, size) with no membership tests.
+//
+// The Registry calls TryInsert after adding an owned component and Erase
+// before removing one; both keep the prefix packed with SwapDense.
+// ---------------------------------------------------------------------------
+struct GroupData {
+    ComponentMask       owned;
+    std::vector<IPool*> pools;
+    uint32_t            size = 0;
+
+    [[nodiscard]] bool Contains(uint32_t idx) const {
+        return pools[0]->Contains(idx) && pools[0]->DenseIndex(idx) < size;
+    }
+
+    // Move idx into the prefix if it now owns every grouped component.
+    void TryInsert(uint32_t idx, const ComponentMask& signature) {
+        if ((signature & owned) != owned || Contains(idx)) return;
+        for (IPool* p : pools) p->SwapDense(p->DenseIndex(idx), size);
+        ++size;
+    }
+
+    // Move idx out of the prefix (to just past its end) before one of its
+    // grouped components is removed.
+    void Erase(uint32_t idx) {
+        if (!Contains(idx)) return;
+        --size;
+        for (IPool* p : pools) p->SwapDense(p->DenseIndex(idx), size);
+    }
+};
+
+// The Registry's change tick. Atomic so systems running in parallel may
+// advance it; the wrapper only keeps the Registry movable.
+struct ChangeTick {
+    std::atomic<uint32_t> value{ 1u };
+
+    ChangeTick() = default;
+    ChangeTick(ChangeTick&& other) noexcept
+        : value(other.value.load(std::memory_order_relaxed)) {}
+    ChangeTick& operator=(ChangeTick&& other) noexcept {
+        value.store(other.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+};
+
+} // namespace detail
+
 // ---------------------------------------------------------------------------
 // Registry — the central ECS world object.
 //
 // Responsibilities
 // ----------------
-//  • Entity lifecycle  : CreateEntity / DestroyEntity / IsAlive
-//  • Component API     : AddComponent / GetComponent / HasComponent /
-//                        RemoveComponent / GetOrAdd
+//  • Entity lifecycle  : CreateEntity / CreateEntities / DestroyEntity /
+//                        DestroyEntities / IsAlive
+//  • Component API     : AddComponent / AddComponents / GetComponent /
+//                        HasComponent / RemoveComponent / GetOrAdd
+//  • Prefabs           : Instantiate  bulk-spawn copies of a Prefab
 //  • Querying          : View<Ts...>  iterate entities with ALL of Ts
 //                        Each<T>      iterate every entity with a single T
+//                        ParallelView / ParallelEach  the same, chunked
+//                                     across the JobSystem's workers
+//                        Group<Ts...> owning group: lock-step packed arrays
+//  • Deferred mutation : Commands / Sync / IsIterating
+//  • Change tracking   : TrackChanges<T> / Tick / AdvanceTick /
+//                        ViewChanged<T>
+//  • Sorting           : Sort<T> / SortByKey<T> / SortAs<U, T>  reorder
+//                        pools in place for linear iteration
+//  • Lifecycle signals : OnConstruct<T> / OnUpdate<T> / OnDestroy<T>,
+//                        delivered in batches at Sync()
+//  • Memory            : Arena / Reserve<T> / ReserveEntities /
+//                        ReleaseMemory  per-registry pool arena
+//  • Diagnostics       : MemoryStats  per-pool resident bytes
 //
 // Usage example
 // -------------
@@ -43,18 +124,82 @@ namespace Hotones::ECS {
 //   The Registry is NOT thread-safe. Wrap external access in a mutex if you
 //   call it from multiple threads.
 //
+//   The exceptions are the SystemScheduler's parallel phase and the
+//   callbacks of ParallelView / ParallelEach: while those hold the registry
+//   in iteration, worker threads may View / Each / GetComponent the types
+//   they own, and DestroyEntity / RemoveComponent / Commands() go to a
+//   per-system or per-chunk CommandBuffer installed with a CommandScope.
+//   CreateEntity and AddComponent are rejected there.
+//
 // Mutation during View / Each
 // ---------------------------
-//   AddComponent / RemoveComponent / DestroyEntity inside a View callback
-//   for one of the iterated component types is NOT safe and may cause missed
-//   or double-processed entities. Defer such mutations with a command queue
-//   and flush them after the view completes.
+//   Views walk the live dense arrays of the pools in place (no snapshot, no
+//   allocation), so structural changes must not happen mid-loop:
+//
+//   • DestroyEntity / RemoveComponent are recorded into the Registry's
+//     CommandBuffer automatically while a view is running.
+//   • AddComponent / GetOrAdd assert — use Commands().Add<T>(id, ...) instead.
+//   • CreateEntity is allowed: it only touches the entity table, never a
+//     pool. Components for the new entity go through Commands() as above.
+//
+//   Recorded commands are played back when the outermost View / Each
+//   returns, or at an explicit Sync() point.
+//
+// Change tracking
+// ---------------
+//   Pools opted in with TrackChanges<T>() stamp each component with the
+//   current Tick() whenever it is added or handed out mutably: the non-const
+//   GetComponent / GetOrAdd, and every T& passed to View / Each / their
+//   Parallel forms / OwningGroup::Each and Data. Name the type const to read
+//   without stamping:
+//
+//     reg.View<TransformComponent, const VelocityComponent>(...);
+//
+//   A consumer that wants each change once closes a tick per run:
+//
+//     const uint32_t since = m_synced;
+//     m_synced = reg.AdvanceTick();
+//     reg.ViewChanged<TransformComponent>(since, [&](EntityId e, const TransformComponent& t) {
+//         ...   // everything added or written since the previous run
+//     });
+//
+//   Stamps are conservative: a mutable access counts as a change even if
+//   the caller did not write. Writes through raw pool arrays are not seen
+//   unless followed by MarkChanged / ComponentPool::TouchRange.
+//
+// Lifecycle signals
+// -----------------
+//   Code that mirrors components into its own structures (physics bodies,
+//   audio voices, Lua refs, GPU resources) subscribes per component type
+//   instead of polling every entity:
+//
+//     reg.OnConstruct<ColliderSphereComponent>(
+//         [](Registry& r, std::span<const EntityId> added) { ... });
+//     reg.OnDestroy<RenderModelComponent>(
+//         [](Registry&, std::span<const EntityId> ids, std::span<RenderModelComponent> models) {
+//             for (auto& m : models) if (m.ownsModel) UnloadModel(m.model);
+//         });
+//
+//   Mutations only record; each handler runs once per sync point with the
+//   whole batch. Sync points are Sync(), the end of SystemScheduler::Update
+//   and Clear(). Per type, constructs are delivered first (entities that
+//   gained T and still own it), then updates (T handed out mutably since
+//   the last dispatch, see change tracking; new components excluded), then
+//   destroys (T removed, with the removed values moved out for cleanup).
+//   A T added and removed within one batch is reported as a destroy only.
+//   Handlers may mutate the registry; what they cause is delivered at the
+//   next sync point.
 // ---------------------------------------------------------------------------
 
 class Registry {
 public:
-    Registry()  = default;
-    ~Registry() = default;
+    Registry() = default;
+
+    // Pool memory belongs to m_arena: drop the pools before it goes.
+    ~Registry() {
+        m_groups.clear();
+        m_pools.clear();
+    }
 
     // Non-copyable; move is fine.
     Registry(const Registry&)            = delete;
@@ -67,33 +212,94 @@ public:
     // -----------------------------------------------------------------------
 
     // Create a new entity. Reuses freed slots when available.
+    // Safe to call from inside a View / Each callback, but not from a
+    // system running in parallel (declare it Exclusive instead).
     [[nodiscard]] EntityId CreateEntity() {
+        assert(!HasCommandScope() && "Registry::CreateEntity — not allowed from a parallel system");
         uint32_t idx;
+        // Snapshot::ApplyDelta can revive a slot that is still queued here.
+        while (!m_freeList.empty() && SlotAlive(m_freeList.front())) m_freeList.pop();
         if (!m_freeList.empty()) {
             idx = m_freeList.front();
             m_freeList.pop();
         } else {
             idx = static_cast<uint32_t>(m_generations.size());
             m_generations.push_back(0u);
+            m_signatures .emplace_back();
+            m_alivePos   .push_back(0u);
         }
         const EntityId id = MakeEntity(idx, m_generations[idx]);
+        m_alivePos[idx] = static_cast<uint32_t>(m_alive.size());
         m_alive.push_back(id);
         return id;
     }
 
+    // Create out.size() entities, writing their ids to out. Same rules as
+    // CreateEntity; the entity table grows once.
+    void CreateEntities(std::span<EntityId> out) {
+        if (m_alive.size() + out.size() > m_alive.capacity())
+            m_alive.reserve(std::max(m_alive.size() + out.size(), m_alive.capacity() * 2));
+        for (EntityId& id : out) id = CreateEntity();
+    }
+
+    // Create count entities carrying a copy of every component of prefab.
+    // Components are added pool by pool: each pool is grown once and
+    // filled in one pass. Inside a View / Each the entities are created
+    // immediately and their components deferred like Commands().Add.
+    std::vector<EntityId> Instantiate(const Prefab& prefab, size_t count) {
+        std::vector<EntityId> ids(count);
+        Instantiate(prefab, ids);
+        return ids;
+    }
+
+    // Same, writing the new ids to out (one entity per element).
+    void Instantiate(const Prefab& prefab, std::span<EntityId> out) {
+        assert(!HasCommandScope() && "Registry::Instantiate — not allowed from a parallel system");
+        CreateEntities(out);
+        if (IsIterating()) {
+            for (const auto& component : prefab.m_components) component->Defer(m_commands, out);
+            return;
+        }
+        for (const auto& component : prefab.m_components) component->Construct(*this, out);
+    }
+
     // Destroy an entity: removes all its components and invalidates the id.
+    // Only the pools named in the entity's signature are touched. O(k) in
+    // the number of components the entity owns.
+    // Inside a View / Each the destruction is deferred until the view ends.
     void DestroyEntity(EntityId id) {
         if (!IsAlive(id)) return;
+        if (IsIterating()) { Commands().Destroy(id); return; }
         const uint32_t idx = EntityIndex(id);
-        // Strip every component pool
-        for (auto& [ti, pool] : m_pools)
-            pool->Remove(idx);
-        // Bump generation so the old EntityId becomes stale
-        ++m_generations[idx];
-        m_freeList.push(idx);
-        // Remove from alive list
-        auto it = std::find(m_alive.begin(), m_alive.end(), id);
-        if (it != m_alive.end()) m_alive.erase(it);
+        const ComponentMask& sig = m_signatures[idx];
+        for (ComponentTypeId type = 0; sig.any() && type < m_pools.size(); ++type)
+            if (sig.test(type)) StripComponent(type, idx);
+        Retire(idx);
+    }
+
+    // Destroy many entities at once. Stale / duplicate ids are skipped.
+    // Components are stripped pool by pool rather than entity by entity, so
+    // each pool's arrays are walked while hot in cache.
+    // Inside a View / Each the destructions are deferred until the view ends.
+    void DestroyEntities(std::span<const EntityId> ids) {
+        if (IsIterating()) {
+            CommandBuffer& commands = Commands();
+            for (const EntityId id : ids)
+                if (IsAlive(id)) commands.Destroy(id);
+            return;
+        }
+        ComponentMask owned;
+        for (const EntityId id : ids)
+            if (IsAlive(id)) owned |= m_signatures[EntityIndex(id)];
+        for (ComponentTypeId type = 0; owned.any() && type < m_pools.size(); ++type) {
+            if (!owned.test(type)) continue;
+            owned.reset(type);
+            for (const EntityId id : ids)
+                if (IsAlive(id) && m_signatures[EntityIndex(id)].test(type))
+                    StripComponent(type, EntityIndex(id));
+        }
+        for (const EntityId id : ids)
+            if (IsAlive(id)) Retire(EntityIndex(id));
     }
 
     // Returns true if the entity has not been destroyed (generation matches).
@@ -110,12 +316,34 @@ public:
 
     [[nodiscard]] size_t EntityCount() const noexcept { return m_alive.size(); }
 
+    // Live id of the entity in slot idx, e.g. an entry of a pool's
+    // EntityIndices() when walking pools type-erased.
+    [[nodiscard]] EntityId EntityAt(uint32_t idx) const noexcept {
+        assert(idx < m_generations.size() && "Registry::EntityAt — slot out of range");
+        return MakeEntity(idx, m_generations[idx]);
+    }
+
     // Destroy every entity and clear every component pool.
+    // Pending deferred commands are discarded.
+    // OnDestroy handlers receive every component before Clear() returns.
     void Clear() {
+        assert(!IsIterating() && "Registry::Clear — called from inside a View / Each");
+        for (ComponentTypeId type = 0; type < m_signals.size(); ++type) {
+            detail::ISignals* signals = m_signals[type].get();
+            if (!signals || !signals->WantsDestroy() || type >= m_pools.size() || !m_pools[type]) continue;
+            for (const uint32_t idx : m_pools[type]->EntityIndices())
+                signals->Capture(*m_pools[type], idx, MakeEntity(idx, m_generations[idx]));
+        }
+        m_commands.Clear();
         m_alive.clear();
         m_generations.clear();
+        m_signatures.clear();
+        m_alivePos.clear();
         while (!m_freeList.empty()) m_freeList.pop();
-        for (auto& [ti, pool] : m_pools) pool->Clear();
+        for (auto& pool : m_pools)
+            if (pool) pool->Clear();
+        for (auto& group : m_groups) group->size = 0;
+        DispatchSignals();
     }
 
     // -----------------------------------------------------------------------
@@ -124,10 +352,49 @@ public:
 
     // Construct a T in-place on entity id from args.
     // Asserts the entity is alive and does not already own a T.
+    // Not allowed inside a View / Each — use Commands().Add<T>() there.
+    // Returns the new component, or nothing for SoA components (which have
+    // no address; use Pool<T>().Load / Store).
     template<typename T, typename... Args>
-    T& AddComponent(EntityId id, Args&&... args) {
+    decltype(auto) AddComponent(EntityId id, Args&&... args) {
         assert(IsAlive(id) && "Registry::AddComponent — entity is not alive");
-        return Pool<T>().Emplace(EntityIndex(id), std::forward<Args>(args)...);
+        assert(!IsIterating() && "Registry::AddComponent — use Commands().Add<T>() inside a View / Each");
+        const uint32_t        idx  = EntityIndex(id);
+        const ComponentTypeId type = ComponentType<T>();
+        PoolFor<T>&           pool = Pool<T>();
+        if constexpr (IsSoAComponent<T>) pool.Emplace(idx, T{ std::forward<Args>(args)... });
+        else                             pool.Emplace(idx, std::forward<Args>(args)...);
+        m_signatures[idx].set(type);
+        if (detail::GroupData* group = GroupOf(type))
+            group->TryInsert(idx, m_signatures[idx]);
+        if (detail::ISignals* signals = SignalsOf(type); signals && signals->WantsConstruct())
+            signals->constructed.push_back(id);
+        // Re-fetch: joining a group may have moved the new component.
+        if constexpr (!IsSoAComponent<T>) return pool.Write(idx, Tick());
+    }
+
+    // Add a copy of value to every entity of ids. Same rules as
+    // AddComponent, but the pool, group and signal lookups happen once and
+    // the pool grows once.
+    template<typename T>
+    void AddComponents(std::span<const EntityId> ids, const T& value) {
+        assert(!IsIterating() && "Registry::AddComponents — use Commands().Add<T>() inside a View / Each");
+        const ComponentTypeId type    = ComponentType<T>();
+        PoolFor<T>&           pool    = Pool<T>();
+        detail::GroupData*    group   = GroupOf(type);
+        detail::ISignals*     signals = SignalsOf(type);
+        const bool            record  = signals && signals->WantsConstruct();
+        const uint32_t        tick    = Tick();
+        pool.Reserve(pool.Size() + ids.size());
+        for (const EntityId id : ids) {
+            assert(IsAlive(id) && "Registry::AddComponents — entity is not alive");
+            const uint32_t idx = EntityIndex(id);
+            pool.Emplace(idx, value);
+            if constexpr (!IsSoAComponent<T>) pool.Touch(idx, tick);
+            m_signatures[idx].set(type);
+            if (group)  group->TryInsert(idx, m_signatures[idx]);
+            if (record) signals->constructed.push_back(id);
+        }
     }
 
     // Returns true if entity id owns a component of type T.
@@ -138,24 +405,32 @@ public:
     }
 
     // Returns a reference to the T owned by entity id.
-    // Asserts the entity is alive and owns a T.
+    // Asserts the entity is alive and owns a T. The non-const overload
+    // counts as a change for TrackChanges.
     template<typename T>
     [[nodiscard]] T& GetComponent(EntityId id) {
+        static_assert(AllAoSComponents<T>, "Registry::GetComponent — SoA components are read with Pool<T>().Load()");
         assert(IsAlive(id)        && "Registry::GetComponent — entity is not alive");
         assert(HasComponent<T>(id) && "Registry::GetComponent — entity does not own component");
-        return Pool<T>().Get(EntityIndex(id));
+        return Pool<T>().Write(EntityIndex(id), Tick());
     }
     template<typename T>
     [[nodiscard]] const T& GetComponent(EntityId id) const {
+        static_assert(AllAoSComponents<T>, "Registry::GetComponent — SoA components are read with Pool<T>().Load()");
         assert(IsAlive(id)        && "Registry::GetComponent — entity is not alive");
         assert(HasComponent<T>(id) && "Registry::GetComponent — entity does not own component");
         return PoolConst<T>().Get(EntityIndex(id));
     }
 
     // Remove T from entity id (no-op if it doesn't own one).
+    // Inside a View / Each the removal is deferred until the view ends.
     template<typename T>
     void RemoveComponent(EntityId id) {
-        if (auto* p = PoolPtr<T>()) p->Remove(EntityIndex(id));
+        if (IsIterating()) { Commands().Remove<T>(id); return; }
+        if (!IsAlive(id)) return;
+        const uint32_t        idx  = EntityIndex(id);
+        const ComponentTypeId type = ComponentType<T>();
+        if (m_signatures[idx].test(type)) StripComponent(type, idx);
     }
 
     // If entity id already owns a T, return it; otherwise default-construct one.
@@ -170,84 +445,513 @@ public:
     // -----------------------------------------------------------------------
 
     // View<Ts...>(fn) — calls fn(EntityId, Ts&...) for every entity that
-    // owns ALL of the listed component types.
+    // owns ALL of the listed component types. const-qualified Ts are handed
+    // out as const T& and not stamped by change tracking.
     //
-    // The iteration order is determined by the smallest component pool.
-    // A snapshot of entity indices is taken before the loop starts, so
-    // adding entities during iteration is safe; removing the *iterated*
-    // component types mid-loop is NOT.
+    // The iteration order is determined by the smallest component pool,
+    // whose dense index array is walked in place. Pool pointers are resolved
+    // once up front, so the per-entity membership test is a plain
+    // sparse-array read per component type. Structural changes made by fn
+    // are deferred (see "Mutation during View / Each" above).
     template<typename... Ts, typename Fn>
     void View(Fn&& fn) {
         static_assert(sizeof...(Ts) > 0, "View requires at least one component type");
+        static_assert(AllAoSComponents<Ts...>, "View — SoA components are iterated through Pool<T>() streams");
 
-        IPool* smallest = FindSmallestPool<Ts...>();
-        if (!smallest || smallest->Size() == 0) return;
+        const std::tuple<PoolFor<Ts>*...> pools{ PoolPtr<Ts>()... };
+        // A missing pool means no entity can match.
+        if (!(std::get<PoolFor<Ts>*>(pools) && ...)) return;
 
-        // Snapshot the dense index list to avoid iterator invalidation.
-        const auto idxList = smallest->EntityIndices();
+        const IPool* smallest = FindSmallestPool(std::get<PoolFor<Ts>*>(pools)...);
+        if (smallest->Size() == 0) return;
 
-        for (const uint32_t idx : idxList) {
-            if (!HasAllAt<Ts...>(idx)) continue;
+        IterationScope scope(*this);
+        const uint32_t tick = Tick();
+        const std::pmr::vector<uint32_t>& dense = smallest->EntityIndices();
+        for (size_t i = 0, n = dense.size(); i < n; ++i) {
+            const uint32_t idx = dense[i];
+            if (!(std::get<PoolFor<Ts>*>(pools)->Has(idx) && ...)) continue;
             // Rebuild the live EntityId for this slot.
-            if (idx >= m_generations.size()) continue;
             const EntityId id = MakeEntity(idx, m_generations[idx]);
-            fn(id, Pool<Ts>().Get(idx)...);
+            fn(id, Access<Ts>(*std::get<PoolFor<Ts>*>(pools), idx, tick)...);
         }
     }
 
     // Each<T>(fn) — calls fn(EntityId, T&) for every entity that owns T.
-    // Slightly cheaper than View<T> because there is no intersection test.
+    // Cheaper than View<T>: walks the dense arrays directly, with no
+    // membership test and no sparse lookup. Each<const T> reads only.
     template<typename T, typename Fn>
     void Each(Fn&& fn) {
+        static_assert(AllAoSComponents<T>, "Each — SoA components are iterated through Pool<T>() streams");
         auto* p = PoolPtr<T>();
         if (!p || p->Size() == 0) return;
-        const auto idxList = p->EntityIndices(); // snapshot
-        for (const uint32_t idx : idxList) {
-            if (idx >= m_generations.size()) continue;
-            const EntityId id = MakeEntity(idx, m_generations[idx]);
-            fn(id, p->Get(idx));
+        IterationScope scope(*this);
+        const std::pmr::vector<uint32_t>& dense = p->EntityIndices();
+        auto&                        data  = p->Components();
+        if constexpr (!std::is_const_v<T>) p->TouchRange(0, dense.size(), Tick());
+        for (size_t i = 0, n = dense.size(); i < n; ++i) {
+            const uint32_t idx = dense[i];
+            const EntityId id  = MakeEntity(idx, m_generations[idx]);
+            fn(id, static_cast<T&>(data[i]));
+        }
+    }
+
+    // ParallelEach<T>(fn) / ParallelView<Ts...>(fn) — Each / View with the
+    // dense array split into chunks that run concurrently on the JobSystem
+    // (the calling thread helps). Returns once every chunk is done.
+    //
+    // fn is called from several threads at once: it may write the
+    // components it is handed but must not touch another entity's. Chunks
+    // hold at least minChunk entities and span whole cache lines of the
+    // array being split, so neighbouring chunks do not write the same line.
+    //
+    // DestroyEntity / RemoveComponent / Commands() inside fn are recorded
+    // into one CommandBuffer per chunk and merged in chunk order, so the
+    // playback order is the same as a serial Each. CreateEntity and
+    // AddComponent must not be called (they assert on worker threads).
+    // Pools that fit in one chunk run on the calling thread.
+    template<typename T, typename Fn>
+    void ParallelEach(Fn&& fn, size_t minChunk = PARALLEL_MIN_CHUNK) {
+        static_assert(AllAoSComponents<T>, "ParallelEach — SoA components are iterated through Pool<T>() streams");
+        auto* p = PoolPtr<T>();
+        if (!p || p->Size() == 0) return;
+        const std::pmr::vector<uint32_t>& dense = p->EntityIndices();
+        auto&                        data  = p->Components();
+        if constexpr (!std::is_const_v<T>) p->TouchRange(0, dense.size(), Tick());
+        ParallelChunks(dense.size(), sizeof(T), minChunk, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const uint32_t idx = dense[i];
+                fn(MakeEntity(idx, m_generations[idx]), static_cast<T&>(data[i]));
+            }
+        });
+    }
+
+    template<typename... Ts, typename Fn>
+    void ParallelView(Fn&& fn, size_t minChunk = PARALLEL_MIN_CHUNK) {
+        static_assert(sizeof...(Ts) > 0, "ParallelView requires at least one component type");
+        static_assert(AllAoSComponents<Ts...>, "ParallelView — SoA components are iterated through Pool<T>() streams");
+
+        const std::tuple<PoolFor<Ts>*...> pools{ PoolPtr<Ts>()... };
+        if (!(std::get<PoolFor<Ts>*>(pools) && ...)) return;
+
+        const IPool* smallest = FindSmallestPool(std::get<PoolFor<Ts>*>(pools)...);
+        if (smallest->Size() == 0) return;
+
+        const uint32_t tick = Tick();
+        const std::pmr::vector<uint32_t>& dense = smallest->EntityIndices();
+        ParallelChunks(dense.size(), sizeof(uint32_t), minChunk, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const uint32_t idx = dense[i];
+                if (!(std::get<PoolFor<Ts>*>(pools)->Has(idx) && ...)) continue;
+                fn(MakeEntity(idx, m_generations[idx]), Access<Ts>(*std::get<PoolFor<Ts>*>(pools), idx, tick)...);
+            }
+        });
+    }
+
+    // Default lower bound on entities per ParallelEach / ParallelView chunk.
+    static constexpr size_t PARALLEL_MIN_CHUNK = 1024;
+
+    // Group<Ts...>() — an owning group over Ts (at least two types).
+    //
+    // The group takes ownership of the pools of Ts and keeps every entity
+    // that owns all of them packed at the front of each pool, at matching
+    // dense indices. AddComponent / RemoveComponent / DestroyEntity keep the
+    // packing up to date, so OwningGroup::Each is a linear lock-step scan.
+    //
+    // The first call builds the group (O(n) over the smallest pool); later
+    // calls with the same types return a handle to the same group. A
+    // component type can be owned by at most one group. The returned handle
+    // is cheap to copy but does not survive moving the Registry.
+    template<typename... Ts>
+    [[nodiscard]] OwningGroup<Ts...> Group();
+
+    // -----------------------------------------------------------------------
+    // Change tracking
+    // -----------------------------------------------------------------------
+
+    // Start keeping a change tick per T (see "Change tracking" above).
+    // Components T already has count as changed at the current tick.
+    // Not allowed inside a View / Each.
+    template<typename T>
+    void TrackChanges() {
+        static_assert(AllAoSComponents<T>, "Registry::TrackChanges — SoA components are not tracked");
+        assert(!IsIterating() && "Registry::TrackChanges — called from inside a View / Each");
+        Pool<T>().EnableChangeTicks(Tick());
+    }
+
+    // The tick mutable accesses are stamped with right now.
+    [[nodiscard]] uint32_t Tick() const noexcept {
+        return m_tick.value.load(std::memory_order_relaxed);
+    }
+
+    // Close the current tick and return it: later accesses are stamped with
+    // a higher one. Safe to call from systems running in parallel.
+    uint32_t AdvanceTick() noexcept {
+        return m_tick.value.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    // Stamp entity id's T as changed, after writing it through a raw pool
+    // array. No-op if T is not tracked or id does not own one.
+    template<typename T>
+    void MarkChanged(EntityId id) {
+        auto* p = PoolPtr<T>();
+        if (p && IsAlive(id) && p->Has(EntityIndex(id))) p->Touch(EntityIndex(id), Tick());
+    }
+
+    // ViewChanged<T>(sinceTick, fn) — calls fn(EntityId, const T&) for every
+    // T added or handed out mutably after tick sinceTick, i.e. stamped with
+    // a tick greater than sinceTick. Asserts TrackChanges<T>() was called.
+    // Cost is one compare per component; structural changes made by fn are
+    // deferred like in View.
+    template<typename T, typename Fn>
+    void ViewChanged(uint32_t sinceTick, Fn&& fn) {
+        static_assert(AllAoSComponents<T>, "Registry::ViewChanged — SoA components are not tracked");
+        auto* p = PoolPtr<T>();
+        if (!p || p->Size() == 0) return;
+        assert(p->TracksChanges() && "Registry::ViewChanged — call TrackChanges<T>() first");
+        const uint32_t* ticks = p->ChangeTicks();
+        if (!ticks) return;
+        IterationScope scope(*this);
+        const std::pmr::vector<uint32_t>& dense = p->EntityIndices();
+        const auto&                  data  = p->Components();
+        for (size_t i = 0, n = dense.size(); i < n; ++i) {
+            if (ticks[i] <= sinceTick) continue;
+            const uint32_t idx = dense[i];
+            fn(MakeEntity(idx, m_generations[idx]), data[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------
+    // Sorting
+    // -----------------------------------------------------------------------
+
+    // Sort<T>(less) — reorder T's pool in place so Each / View / ViewChanged
+    // walk its components in `less` order. Entity indices, components and
+    // change ticks move together and the sparse map is fixed up, so ids and
+    // component values are untouched; only references into the pool go
+    // stale. less(const T&, const T&) is a strict weak ordering.
+    //
+    // If T is owned by a group, the group's prefix is sorted in lock-step
+    // across every owned pool (it stays a valid group) and the entities
+    // outside it are sorted separately behind it.
+    //
+    // O(n log n) compares plus one gather per pool. Not allowed inside a
+    // View / Each.
+    template<typename T, typename Compare>
+    void Sort(Compare&& less) {
+        static_assert(AllAoSComponents<T>, "Registry::Sort — SoA components cannot be sorted by value");
+        assert(!IsIterating() && "Registry::Sort — called from inside a View / Each");
+        const auto* p = PoolPtr<T>();
+        if (!p) return;
+        const std::pmr::vector<T>& data = p->Components();
+        SortPool(ComponentType<T>(), [&](std::span<uint32_t> order) {
+            std::sort(order.begin(), order.end(),
+                [&](uint32_t a, uint32_t b) { return less(data[a], data[b]); });
+        });
+    }
+
+    // SortByKey<T>(key) — Sort by key(const T&), computed once per component
+    // rather than twice per compare. For keys that cost more than a load,
+    // e.g. a Morton code of a position.
+    template<typename T, typename KeyFn>
+    void SortByKey(KeyFn&& key) {
+        static_assert(AllAoSComponents<T>, "Registry::SortByKey — SoA components cannot be sorted by value");
+        assert(!IsIterating() && "Registry::SortByKey — called from inside a View / Each");
+        const auto* p = PoolPtr<T>();
+        if (!p) return;
+        const std::pmr::vector<T>& data = p->Components();
+        using Key = std::decay_t<std::invoke_result_t<KeyFn&, const T&>>;
+        std::vector<std::pair<Key, uint32_t>> keyed;
+        SortPool(ComponentType<T>(), [&](std::span<uint32_t> order) {
+            keyed.clear();
+            keyed.reserve(order.size());
+            for (const uint32_t pos : order) keyed.emplace_back(key(data[pos]), pos);
+            const auto byKey = [](const auto& a, const auto& b) { return a.first < b.first; };
+            if (std::is_sorted(keyed.begin(), keyed.end(), byKey)) return;
+            std::sort(keyed.begin(), keyed.end(), byKey);
+            for (size_t k = 0; k < order.size(); ++k) order[k] = keyed[k].second;
+        });
+    }
+
+    // SortAs<U, T>() — reorder U's pool to follow T's: entities owning both
+    // come first, in the order T's pool lists them, followed by the ones
+    // without a T. Call it after Sort<T> so a View<T, U> walks both arrays
+    // forward.
+    //
+    // If U is owned by a group, its group prefix is left where it is and
+    // only the entities behind it follow T. O(size of T's pool). Works for
+    // SoA pools. Not allowed inside a View / Each.
+    template<typename U, typename T>
+    void SortAs() {
+        static_assert(!std::is_same_v<U, T>, "Registry::SortAs — U and T must differ");
+        assert(!IsIterating() && "Registry::SortAs — called from inside a View / Each");
+        auto*       follower = PoolPtr<U>();
+        const auto* leader   = PoolPtr<T>();
+        if (!follower || !leader) return;
+        const detail::GroupData* group = GroupOf(ComponentType<U>());
+        const uint32_t begin = group ? group->size : 0u;
+        uint32_t next = begin;
+        for (const uint32_t idx : leader->EntityIndices()) {
+            if (!follower->Contains(idx)) continue;
+            const uint32_t pos = follower->DenseIndex(idx);
+            if (pos < begin) continue;   // group member: its slot belongs to the group
+            follower->SwapDense(pos, next++);
+        }
+    }
+
+    // -----------------------------------------------------------------------
+    // Deferred mutation
+    // -----------------------------------------------------------------------
+
+    // True while a View / Each callback is running on this registry.
+    [[nodiscard]] bool IsIterating() const noexcept { return m_iterationDepth > 0; }
+
+    // The registry's command buffer. Record structural changes here from
+    // inside a view; they are applied when the outermost view returns.
+    // On a thread inside a CommandScope this is the scope's buffer instead.
+    [[nodiscard]] CommandBuffer& Commands() noexcept {
+        return HasCommandScope() ? *t_commandScope.buffer : m_commands;
+    }
+
+    // CommandScope — routes the calling thread's deferred mutations on reg
+    // into buffer for the lifetime of the scope. Views started on that
+    // thread leave the registry's shared iteration depth alone; whoever
+    // installs the scope must hold the registry in iteration (the
+    // SystemScheduler does) and flush buffer afterwards. Scopes nest.
+    class CommandScope {
+    public:
+        CommandScope(Registry& reg, CommandBuffer& buffer) noexcept
+            : m_prev(t_commandScope) { t_commandScope = { &reg, &buffer }; }
+        ~CommandScope() { t_commandScope = m_prev; }
+        CommandScope(const CommandScope&)            = delete;
+        CommandScope& operator=(const CommandScope&) = delete;
+    private:
+        struct Binding { const Registry* reg; CommandBuffer* buffer; };
+        friend class Registry;
+        Binding m_prev;
+    };
+
+    // Explicit sync point: apply every pending command now, then deliver
+    // pending lifecycle signals. No-op (and asserts) while a view is running.
+    void Sync() {
+        assert(!IsIterating() && "Registry::Sync — called from inside a View / Each");
+        if (IsIterating()) return;
+        if (!m_commands.Empty()) m_commands.Flush(*this);
+        DispatchSignals();
+    }
+
+    // -----------------------------------------------------------------------
+    // Lifecycle signals
+    // -----------------------------------------------------------------------
+
+    // fn(Registry&, std::span<const EntityId>) with the entities that gained
+    // a T since the last sync point and still own it.
+    template<typename T, typename Fn>
+    SignalConnection OnConstruct(Fn&& fn) {
+        auto& signals = Signals<T>();
+        ++signals.constructSinks;
+        signals.onConstruct.push_back({ signals.nextId, std::forward<Fn>(fn) });
+        return { ComponentType<T>(), signals.nextId++ };
+    }
+
+    // fn(Registry&, std::span<const EntityId>) with the entities whose T was
+    // handed out mutably since the last sync point. Turns on
+    // TrackChanges<T>().
+    template<typename T, typename Fn>
+    SignalConnection OnUpdate(Fn&& fn) {
+        static_assert(AllAoSComponents<T>, "Registry::OnUpdate — SoA components are not tracked");
+        auto& signals = Signals<T>();
+        if (signals.onUpdate.empty()) {
+            TrackChanges<T>();
+            signals.updateSince = AdvanceTick();   // existing components are not "updated"
         }
+        signals.onUpdate.push_back({ signals.nextId, std::forward<Fn>(fn) });
+        return { ComponentType<T>(), signals.nextId++ };
+    }
+
+    // fn(Registry&, std::span<const EntityId>, std::span<T>) with the
+    // entities that lost a T since the last sync point (most are dead by
+    // then) and the removed components, moved out for cleanup.
+    template<typename T, typename Fn>
+    SignalConnection OnDestroy(Fn&& fn) {
+        auto& signals = Signals<T>();
+        ++signals.destroySinks;
+        signals.onDestroy.push_back({ signals.nextId, std::forward<Fn>(fn) });
+        return { ComponentType<T>(), signals.nextId++ };
+    }
+
+    // Remove a handler. Events it has not seen yet are dropped for it.
+    void Disconnect(SignalConnection connection) {
+        detail::ISignals* signals = SignalsOf(connection.type);
+        if (!signals || connection.id == 0) return;
+        assert(!signals->dispatching && "Registry::Disconnect — called from a handler of the same type");
+        signals->Disconnect(connection.id);
     }
 
     // -----------------------------------------------------------------------
     // Direct pool access (advanced / systems use)
     // -----------------------------------------------------------------------
 
-    // Returns the typed ComponentPool<T>, creating it if it does not exist yet.
+    // Returns the typed pool of T (ComponentPool<T>, or SoAPool<T> for SoA
+    // components), creating it if it does not exist yet.
+    //
+    // Adding / removing through the pool directly bypasses the entity
+    // signatures — go through AddComponent / RemoveComponent for that.
     template<typename T>
-    [[nodiscard]] ComponentPool<T>& Pool() {
-        const auto key = std::type_index(typeid(T));
-        auto it = m_pools.find(key);
-        if (it == m_pools.end()) {
-            auto pool = std::make_unique<ComponentPool<T>>();
-            auto* raw = pool.get();
-            m_pools.emplace(key, std::move(pool));
-            return *raw;
+    [[nodiscard]] PoolFor<T>& Pool() {
+        const ComponentTypeId type = ComponentType<T>();
+        assert(type < MAX_COMPONENT_TYPES && "Registry::Pool — raise MAX_COMPONENT_TYPES");
+        if (type >= m_pools.size()) m_pools.resize(type + 1);
+        auto& slot = m_pools[type];
+        if (!slot) {
+            if (!m_arena) m_arena = std::make_unique<MemoryArena>();   // moved-from registry
+            slot = std::make_unique<PoolFor<T>>(m_arena.get());
         }
-        return *static_cast<ComponentPool<T>*>(it->second.get());
+        return *static_cast<PoolFor<T>*>(slot.get());
     }
 
     template<typename T>
-    [[nodiscard]] ComponentPool<T>* PoolPtr() {
-        const auto key = std::type_index(typeid(T));
-        const auto it  = m_pools.find(key);
-        return it != m_pools.end()
-            ? static_cast<ComponentPool<T>*>(it->second.get())
+    [[nodiscard]] PoolFor<T>* PoolPtr() {
+        const ComponentTypeId type = ComponentType<T>();
+        return type < m_pools.size()
+            ? static_cast<PoolFor<T>*>(m_pools[type].get())
             : nullptr;
     }
 
     template<typename T>
-    [[nodiscard]] const ComponentPool<T>* PoolPtr() const {
-        const auto key = std::type_index(typeid(T));
-        const auto it  = m_pools.find(key);
-        return it != m_pools.end()
-            ? static_cast<const ComponentPool<T>*>(it->second.get())
+    [[nodiscard]] const PoolFor<T>* PoolPtr() const {
+        const ComponentTypeId type = ComponentType<T>();
+        return type < m_pools.size()
+            ? static_cast<const PoolFor<T>*>(m_pools[type].get())
             : nullptr;
     }
 
+    // -----------------------------------------------------------------------
+    // Memory
+    // -----------------------------------------------------------------------
+    //
+    // Every component pool allocates from this registry's MemoryArena, so
+    // tearing a world down is Clear() plus one arena reset instead of a
+    // free per pool array and sparse page. The entity table stays on the
+    // heap.
+
+    // The arena backing this registry's pools (statistics only).
+    [[nodiscard]] const MemoryArena& Arena() const noexcept { return *m_arena; }
+
+    // Make room for n entities in total in the entity table.
+    void ReserveEntities(size_t n) {
+        m_alive      .reserve(n);
+        m_generations.reserve(n);
+        m_signatures .reserve(n);
+        m_alivePos   .reserve(n);
+    }
+
+    // Make room for n components of type T in total, creating the pool.
+    // Sized up front, a pool never leaves an outgrown buffer in the arena.
+    template<typename T>
+    void Reserve(size_t n) { Pool<T>().Reserve(n); }
+
+    // Clear(), then destroy every pool and owning group and reset the arena
+    // in one step; arenaBytes sizes its next first chunk. Pools that track
+    // changes come back empty and still tracked, so TrackChanges callers
+    // (TagIndex, ViewChanged users) keep working; signal handlers stay
+    // connected. Group calls must be made again and OwningGroup handles
+    // become invalid. Not allowed inside a View / Each.
+    void ReleaseMemory(size_t arenaBytes = 0) {
+        Clear();
+        m_groups.clear();
+        m_groupOf.clear();
+        // The replacements are empty, so they hold nothing the reset frees.
+        for (auto& pool : m_pools)
+            if (pool) pool = pool->TracksChanges() ? pool->MakeEmpty() : nullptr;
+        if (m_arena) m_arena->Reset(arenaBytes);
+        else         m_arena = std::make_unique<MemoryArena>(arenaBytes);
+        for (auto& signals : m_signals)
+            if (signals) signals->Reattach(*this);
+    }
+
+    // -----------------------------------------------------------------------
+    // Diagnostics
+    // -----------------------------------------------------------------------
+
+    // Resident bytes of every component pool this registry has created,
+    // split into sparse / dense / data arrays.
+    [[nodiscard]] std::vector<PoolMemoryStats> MemoryStats() const {
+        std::vector<PoolMemoryStats> stats;
+        stats.reserve(m_pools.size());
+        for (const auto& pool : m_pools)
+            if (pool) stats.push_back(pool->MemoryStats());
+        return stats;
+    }
+
 private:
+    template<typename... Ts> friend class OwningGroup;
+    friend class SystemScheduler;
+    friend class Snapshot;
+
     // ---- Internal helpers -------------------------------------------------
 
+    // Marks the registry as iterating for the lifetime of a View / Each and
+    // plays back deferred commands when the outermost one ends.
+    // Inside a CommandScope it does nothing: the depth is shared by every
+    // thread and is already held by whoever installed the scope.
+    struct IterationScope {
+        explicit IterationScope(Registry& r) noexcept
+            : reg(r), counted(!r.HasCommandScope()) { if (counted) ++reg.m_iterationDepth; }
+        ~IterationScope() {
+            if (counted && --reg.m_iterationDepth == 0 && !reg.m_commands.Empty())
+                reg.m_commands.Flush(reg);
+        }
+        IterationScope(const IterationScope&)            = delete;
+        IterationScope& operator=(const IterationScope&) = delete;
+        Registry&  reg;
+        const bool counted;
+    };
+
+    [[nodiscard]] bool HasCommandScope() const noexcept { return t_commandScope.reg == this; }
+
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // Run chunkFn(begin, end) over [0, count) on the job pool, holding the
+    // registry in iteration. itemBytes is the element size of the array
+    // being split; chunk boundaries fall on multiples of a cache line's
+    // worth of elements.
+    template<typename ChunkFn>
+    void ParallelChunks(size_t count, size_t itemBytes, size_t minChunk, ChunkFn&& chunkFn) {
+        JobSystem&   jobs    = JobSystem::Get();
+        const size_t lanes   = size_t(jobs.WorkerCount()) + 1;   // workers + caller
+        const size_t perLine = std::max<size_t>(1, CACHE_LINE_SIZE / itemBytes);
+        // A few chunks per lane so stealing can even out uneven chunks.
+        size_t chunk = std::max<size_t>({ minChunk, (count + lanes * 4 - 1) / (lanes * 4), 1 });
+        chunk = (chunk + perLine - 1) / perLine * perLine;
+        const size_t chunks = (count + chunk - 1) / chunk;
+
+        IterationScope scope(*this);
+        if (chunks <= 1) { chunkFn(size_t{0}, count); return; }
+
+        std::vector<CommandBuffer> buffers(chunks);
+        JobSystem::Counter done;
+        for (size_t c = 0; c < chunks; ++c)
+            jobs.Submit([&, c] {
+                CommandScope redirect(*this, buffers[c]);
+                chunkFn(c * chunk, std::min(count, (c + 1) * chunk));
+            }, done);
+        jobs.Wait(done);
+
+        // Into the caller's buffer (m_commands, or its own CommandScope);
+        // played back when the outermost scope ends.
+        CommandBuffer& target = Commands();
+        for (auto& b : buffers)
+            if (!b.Empty()) target.Append(b);
+    }
+
+    // T& from pool for a view callback, stamped with tick unless T is const.
+    template<typename T>
+    [[nodiscard]] static T& Access(PoolFor<T>& pool, uint32_t idx, uint32_t tick) {
+        if constexpr (std::is_const_v<T>) return pool.Get(idx);
+        else                              return pool.Write(idx, tick);
+    }
+
     template<typename T>
     [[nodiscard]] const ComponentPool<T>& PoolConst() const {
         const auto* p = PoolPtr<T>();
@@ -255,40 +959,371 @@ private:
         return *p;
     }
 
-    // True if entity index idx has every component type in Ts.
-    template<typename... Ts>
-    [[nodiscard]] bool HasAllAt(uint32_t idx) const {
-        return (HasAt<Ts>(idx) && ...);
+    // Remove the component of the given type from idx, leaving its owning
+    // group (if any) first and clearing the signature bit.
+    void StripComponent(ComponentTypeId type, uint32_t idx) {
+        if (detail::ISignals* signals = SignalsOf(type); signals && signals->WantsDestroy())
+            signals->Capture(*m_pools[type], idx, MakeEntity(idx, m_generations[idx]));
+        if (detail::GroupData* group = GroupOf(type)) group->Erase(idx);
+        m_pools[type]->Remove(idx);
+        m_signatures[idx].reset(type);
+    }
+
+    [[nodiscard]] detail::GroupData* GroupOf(ComponentTypeId type) const noexcept {
+        return type < m_groupOf.size() ? m_groupOf[type] : nullptr;
+    }
+
+    // Sort the pool of `type` with sortRange(span of dense positions), which
+    // must leave the span holding, for each new position in order, the old
+    // position of the element that goes there. A group prefix is sorted on
+    // its own and permuted across all the group's pools.
+    template<typename SortRange>
+    void SortPool(ComponentTypeId type, SortRange&& sortRange) {
+        IPool* pool = m_pools[type].get();
+        const detail::GroupData* group = GroupOf(type);
+        const uint32_t split = group ? group->size : 0u;
+        const uint32_t size  = static_cast<uint32_t>(pool->Size());
+        std::vector<uint32_t> order;
+        if (split > 1u) PermuteDense(group->pools, 0u, split, order, sortRange);
+        if (size - split > 1u) PermuteDense(std::span<IPool* const>(&pool, 1), split, size, order, sortRange);
+    }
+
+    // Sort dense range [begin, end) and apply the result to every pool in
+    // pools. Skipped when the sort leaves the range as it was.
+    template<typename SortRange>
+    static void PermuteDense(std::span<IPool* const> pools, uint32_t begin, uint32_t end,
+                             std::vector<uint32_t>& order, SortRange& sortRange) {
+        order.resize(end - begin);
+        std::iota(order.begin(), order.end(), begin);
+        sortRange(std::span<uint32_t>(order));
+        bool moved = false;
+        for (uint32_t k = 0; k < order.size() && !moved; ++k) moved = order[k] != begin + k;
+        if (!moved) return;
+        for (IPool* p : pools) p->Permute(begin, order);
+    }
+
+    [[nodiscard]] detail::ISignals* SignalsOf(ComponentTypeId type) const noexcept {
+        return type < m_signals.size() ? m_signals[type].get() : nullptr;
     }
 
+    // The signals of T, created on first use. Connecting must not happen
+    // from a handler of the same type.
     template<typename T>
-    [[nodiscard]] bool HasAt(uint32_t idx) const {
-        const auto* p = PoolPtr<T>();
-        return p && p->Has(idx);
+    [[nodiscard]] detail::ComponentSignals<std::remove_const_t<T>>& Signals() {
+        using U = std::remove_const_t<T>;
+        const ComponentTypeId type = ComponentType<U>();
+        if (type >= m_signals.size()) m_signals.resize(type + 1);
+        auto& slot = m_signals[type];
+        if (!slot) slot = std::make_unique<detail::ComponentSignals<U>>();
+        assert(!slot->dispatching && "Registry — connecting from a handler of the same type");
+        (void)Pool<U>();   // Capture expects the pool to exist
+        return *static_cast<detail::ComponentSignals<U>*>(slot.get());
     }
 
-    // Return the pool (among those for Ts) with the fewest live components.
-    // Returns nullptr if any pool is missing (result set would be empty).
-    template<typename... Ts>
-    [[nodiscard]] IPool* FindSmallestPool() {
-        IPool* pools[] = { PoolPtr<Ts>()... };
-        IPool* result  = nullptr;
-        size_t minSize = ~size_t(0);
-        for (auto* p : pools) {
-            if (!p) return nullptr; // a missing pool means no entities match
-            if (p->Size() < minSize) { minSize = p->Size(); result = p; }
+    // Deliver pending lifecycle signals, type by type.
+    void DispatchSignals() {
+        for (size_t type = 0; type < m_signals.size(); ++type)
+            if (m_signals[type]) m_signals[type]->Dispatch(*this);
+    }
+
+    // True if slot idx currently holds a live entity (IsAlive also accepts
+    // the id a dead slot would hand out next).
+    [[nodiscard]] bool SlotAlive(uint32_t idx) const noexcept {
+        return idx < m_alivePos.size() && m_alivePos[idx] < m_alive.size()
+            && EntityIndex(m_alive[m_alivePos[idx]]) == idx;
+    }
+
+    // Bring exactly `id` to life, for Snapshot::ApplyDelta. Whatever lives in
+    // its slot is destroyed first; slots skipped on the way are queued free.
+    EntityId CreateEntityWithId(EntityId id) {
+        const uint32_t idx = EntityIndex(id);
+        while (m_generations.size() <= idx) {
+            m_freeList.push(static_cast<uint32_t>(m_generations.size()));
+            m_generations.push_back(0u);
+            m_signatures .emplace_back();
+            m_alivePos   .push_back(0u);
         }
+        if (SlotAlive(idx)) DestroyEntity(m_alive[m_alivePos[idx]]);
+        m_generations[idx] = EntityGeneration(id);
+        m_alivePos[idx]    = static_cast<uint32_t>(m_alive.size());
+        m_alive.push_back(id);
+        return id;
+    }
+
+    // Bump the generation of a slot whose components are already stripped,
+    // recycle it and swap-remove it from the alive list. O(1).
+    void Retire(uint32_t idx) {
+        ++m_generations[idx];
+        m_freeList.push(idx);
+        const uint32_t pos  = m_alivePos[idx];
+        const EntityId last = m_alive.back();
+        m_alive[pos]                  = last;
+        m_alivePos[EntityIndex(last)] = pos;
+        m_alive.pop_back();
+    }
+
+    // Return the pool (among the given, non-null pools) with the fewest
+    // live components.
+    template<typename... Ps>
+    [[nodiscard]] static const IPool* FindSmallestPool(const Ps*... candidates) {
+        const IPool* pools[] = { candidates... };
+        const IPool* result  = pools[0];
+        for (auto* p : pools)
+            if (p->Size() < result->Size()) result = p;
         return result;
     }
 
     // ---- Storage ----------------------------------------------------------
 
-    std::vector<EntityId>  m_alive;       // all live EntityIds
-    std::vector<uint32_t>  m_generations; // generations[entityIndex]
-    std::queue<uint32_t>   m_freeList;    // recycled entity indices
+    std::vector<EntityId>      m_alive;       // all live EntityIds (dense, swap-remove)
+    std::vector<uint32_t>      m_generations; // generations[entityIndex]
+    std::vector<ComponentMask> m_signatures;  // signatures[entityIndex] → owned component types
+    std::vector<uint32_t>      m_alivePos;    // alivePos[entityIndex]    → position in m_alive
+    std::queue<uint32_t>       m_freeList;    // recycled entity indices
 
-    // One pool per component type, keyed by std::type_index.
-    std::unordered_map<std::type_index, std::unique_ptr<IPool>> m_pools;
+    // One pool per component type, indexed by ComponentType<T>().
+    // Slots for types this registry has never seen are null.
+    std::vector<std::unique_ptr<IPool>> m_pools;
+
+    // Owning groups, and the group (if any) owning each component type.
+    std::vector<std::unique_ptr<detail::GroupData>> m_groups;
+    std::vector<detail::GroupData*>                 m_groupOf; // indexed by ComponentTypeId
+
+    // Lifecycle signals per component type (null until someone connects).
+    std::vector<std::unique_ptr<detail::ISignals>> m_signals;
+
+    CommandBuffer      m_commands;           // structural changes deferred by views
+    uint32_t           m_iterationDepth = 0; // nesting depth of running views
+    detail::ChangeTick m_tick;               // stamp for tracked mutable accesses
+
+    // Backs every pool. Declared last so that member-wise move assignment
+    // replaces the pools before the arena they were allocated from.
+    std::unique_ptr<MemoryArena> m_arena = std::make_unique<MemoryArena>();
+
+    // The CommandScope installed on the calling thread, if any.
+    static inline thread_local CommandScope::Binding t_commandScope{ nullptr, nullptr };
 };
 
+// ---------------------------------------------------------------------------
+// OwningGroup<Ts...> — handle returned by Registry::Group<Ts...>().
+//
+//   auto movers = reg.Group<TransformComponent, VelocityComponent>();
+//   movers.Each([dt](EntityId, TransformComponent& t, VelocityComponent& v) {
+//       t.position = Vector3Add(t.position, Vector3Scale(v.linear, dt));
+//   });
+//
+//   // or raw lock-step arrays, e.g. for SIMD kernels:
+//   TransformComponent* t = movers.Data<TransformComponent>();
+//   VelocityComponent*  v = movers.Data<VelocityComponent>();
+//   for (size_t i = 0; i < movers.Size(); ++i) { ... t[i] ... v[i] ... }
+//
+// Raw pointers are invalidated by any structural change to the owned pools.
+// ---------------------------------------------------------------------------
+
+template<typename... Ts>
+class OwningGroup {
+public:
+    // Number of entities owning every grouped component.
+    [[nodiscard]] size_t Size() const noexcept { return m_data->size; }
+
+    // Component array of T; elements [0, Size()) belong to the group and
+    // index i refers to the same entity in every Data<U>(). Data<T>() counts
+    // as a change of every grouped T for change tracking; ask for
+    // Data<const T>() to read only.
+    template<typename T>
+    [[nodiscard]] T* Data() const {
+        auto* pool = std::get<ComponentPool<std::remove_const_t<T>>*>(m_pools);
+        if constexpr (!std::is_const_v<T>) pool->TouchRange(0, m_data->size, m_reg->Tick());
+        return pool->Components().data();
+    }
+
+    // Entity at group position i.
+    [[nodiscard]] EntityId Entity(size_t i) const {
+        const uint32_t idx = m_data->pools[0]->EntityIndices()[i];
+        return MakeEntity(idx, m_reg->m_generations[idx]);
+    }
+
+    // Calls fn(EntityId, Ts&...) for every grouped entity. Structural
+    // changes made by fn are deferred like in Registry::View.
+    template<typename Fn>
+    void Each(Fn&& fn) {
+        const size_t n = m_data->size;
+        if (n == 0) return;
+        Registry::IterationScope scope(*m_reg);
+        const std::pmr::vector<uint32_t>& dense = m_data->pools[0]->EntityIndices();
+        const std::tuple<Ts*...> data{ Data<Ts>()... };
+        for (size_t i = 0; i < n; ++i) {
+            const uint32_t idx = dense[i];
+            fn(MakeEntity(idx, m_reg->m_generations[idx]), std::get<Ts*>(data)[i]...);
+        }
+    }
+
+private:
+    friend class Registry;
+
+    OwningGroup(Registry& reg, detail::GroupData& data, ComponentPool<Ts>*... pools)
+        : m_reg(&reg), m_data(&data), m_pools(pools...) {}
+
+    Registry*                         m_reg;
+    detail::GroupData*                m_data;
+    std::tuple<ComponentPool<Ts>*...> m_pools;
+};
+
+template<typename... Ts>
+OwningGroup<Ts...> Registry::Group() {
+    static_assert(sizeof...(Ts) > 1, "Group requires at least two component types");
+    static_assert(AllAoSComponents<Ts...>, "Group — SoA components cannot be grouped");
+    assert(!IsIterating() && "Registry::Group — cannot build a group inside a View / Each");
+
+    ComponentMask mask;
+    (mask.set(ComponentType<Ts>()), ...);
+    const std::tuple<ComponentPool<Ts>*...> pools{ &Pool<Ts>()... };
+
+    for (auto& group : m_groups)
+        if (group->owned == mask)
+            return OwningGroup<Ts...>(*this, *group, std::get<ComponentPool<Ts>*>(pools)...);
+
+    auto group   = std::make_unique<detail::GroupData>();
+    group->owned = mask;
+    group->pools = { std::get<ComponentPool<Ts>*>(pools)... };
+    for (const ComponentTypeId type : { ComponentType<Ts>()... }) {
+        if (type >= m_groupOf.size()) m_groupOf.resize(type + 1, nullptr);
+        assert(!m_groupOf[type] && "Registry::Group — component type is already owned by another group");
+        m_groupOf[type] = group.get();
+    }
+
+    // Pack existing owners. Insertions only swap the current slot with
+    // the (already visited) slot at the end of the prefix, so walking the
+    // smallest pool by index stays valid.
+    const IPool* smallest = FindSmallestPool(std::get<ComponentPool<Ts>*>(pools)...);
+    const std::pmr::vector<uint32_t>& dense = smallest->EntityIndices();
+    for (size_t i = 0; i < dense.size(); ++i) {
+        const uint32_t idx = dense[i];
+        group->TryInsert(idx, m_signatures[idx]);
+    }
+
+    detail::GroupData& data = *group;
+    m_groups.push_back(std::move(group));
+    return OwningGroup<Ts...>(*this, data, std::get<ComponentPool<Ts>*>(pools)...);
+}
+
+// ---------------------------------------------------------------------------
+// CommandBuffer out-of-line members (need the complete Registry).
+// ---------------------------------------------------------------------------
+
+inline void CommandBuffer::Flush(Registry& reg) {
+    // Swap the list out first: playback runs with the registry outside any
+    // view, so nothing new is recorded, but a throwing command must not leave
+    // half-applied entries behind to be replayed.
+    std::vector<Command> commands;
+    commands.swap(m_commands);
+    for (const Command& cmd : commands)
+        cmd.apply(reg, *this, cmd.id, cmd.slot);
+    for (auto& s : m_staging)
+        if (s) s->Clear();
+    // Hand the (now empty) storage back so its capacity is reused.
+    commands.clear();
+    if (m_commands.empty()) m_commands.swap(commands);
+}
+
+inline void CommandBuffer::ApplyDestroy(Registry& reg, CommandBuffer&, EntityId id, uint32_t) {
+    reg.DestroyEntity(id);
+}
+
+template<typename T>
+void CommandBuffer::ApplyAdd(Registry& reg, CommandBuffer& cb, EntityId id, uint32_t slot) {
+    if (!reg.IsAlive(id)) return;
+    T& value = cb.StagingFor<T>().values[slot];
+    if (!reg.HasComponent<T>(id)) reg.AddComponent<T>(id, std::move(value));
+    else if constexpr (IsSoAComponent<T>) reg.Pool<T>().Store(EntityIndex(id), value);
+    else reg.GetComponent<T>(id) = std::move(value);
+}
+
+template<typename T>
+void CommandBuffer::ApplyRemove(Registry& reg, CommandBuffer&, EntityId id, uint32_t) {
+    reg.RemoveComponent<T>(id);
+}
+
+// ---------------------------------------------------------------------------
+// ComponentSignals out-of-line members (need the complete Registry).
+// ---------------------------------------------------------------------------
+
+template<typename T>
+void detail::ComponentSignals<T>::Reattach(Registry& reg) {
+    reg.Reserve<T>(0);   // Capture expects the pool to exist
+    if constexpr (!IsSoAComponent<T>) {
+        if (!onUpdate.empty()) {
+            reg.TrackChanges<T>();
+            updateSince = reg.AdvanceTick();
+        }
+    }
+}
+
+template<typename T>
+void detail::ComponentSignals<T>::Dispatch(Registry& reg) {
+    if (dispatching) return;   // a handler reached a sync point; deliver next time
+    dispatching = true;
+
+    // Pending lists are swapped out first: handlers may mutate the registry,
+    // which records into fresh lists for the next sync point.
+    batch.clear();
+    batch.swap(constructed);
+    std::sort(batch.begin(), batch.end());
+    batch.erase(std::unique(batch.begin(), batch.end()), batch.end());
+    batch.erase(std::remove_if(batch.begin(), batch.end(), [&](EntityId e) {
+        return !reg.IsAlive(e) || !reg.HasComponent<T>(e);
+    }), batch.end());
+    if (!batch.empty())
+        for (auto& sink : onConstruct) sink.fn(reg, batch);
+
+    if constexpr (!IsSoAComponent<T>) {
+        if (!onUpdate.empty()) {
+            const uint32_t since = updateSince;
+            updateSince = reg.AdvanceTick();
+            updated.clear();
+            reg.ViewChanged<T>(since, [&](EntityId e, const T&) {
+                if (!std::binary_search(batch.begin(), batch.end(), e)) updated.push_back(e);
+            });
+            if (!updated.empty())
+                for (auto& sink : onUpdate) sink.fn(reg, updated);
+        }
+    }
+
+    if (!destroyedIds.empty()) {
+        std::vector<EntityId> ids;
+        std::vector<T>        values;
+        ids.swap(destroyedIds);
+        values.swap(destroyedValues);
+        for (auto& sink : onDestroy) sink.fn(reg, ids, values);
+        // Hand the storage back so its capacity is reused.
+        ids.clear();
+        values.clear();
+        if (destroyedIds.empty()) { destroyedIds.swap(ids); destroyedValues.swap(values); }
+    }
+
+    dispatching = false;
+}
+
+// ---------------------------------------------------------------------------
+// Prefab out-of-line members (need the complete Registry).
+// ---------------------------------------------------------------------------
+
+template<typename T>
+void detail::PrefabComponent<T>::Construct(Registry& reg, std::span<const EntityId> ids) const {
+    reg.AddComponents<T>(ids, value);
+}
+
+template<typename T>
+void detail::PrefabComponent<T>::Defer(CommandBuffer& cb, std::span<const EntityId> ids) const {
+    for (const EntityId id : ids) cb.Add<T>(id, value);
+}
+
+template<typename... Ts>
+Prefab Prefab::FromEntity(const Registry& reg, EntityId entity) {
+    assert(reg.IsAlive(entity) && "Prefab::FromEntity — entity is not alive");
+    Prefab prefab;
+    ((reg.HasComponent<Ts>(entity) ? (void)prefab.Set<Ts>(reg.GetComponent<Ts>(entity)) : (void)0), ...);
+    return prefab;
+}
+
 } // namespace Hotones::ECS
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <ECS/Entity.hpp>
+#include <ECS/ComponentType.hpp>
+#include <ECS/ComponentPool.hpp>
+#include <ECS/SoAPool.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Hotones::ECS {
+
+class Registry;
+
+// Handle returned by Registry::OnConstruct / OnUpdate / OnDestroy, for
+// Registry::Disconnect.
+struct SignalConnection {
+    ComponentTypeId type = 0;
+    uint32_t        id   = 0;   // 0 = not connected
+};
+
+namespace detail {
+
+// ---------------------------------------------------------------------------
+// ISignals — type-erased per-component-type lifecycle signals.
+//
+// Recording is cheap and happens where the Registry mutates: the id of every
+// entity that gains a T is appended to `constructed`; a T being removed is
+// moved out of its pool into the typed graveyard (only when someone listens
+// to OnDestroy<T>). Handlers run later, once per type and kind, with the
+// whole batch, when the Registry reaches a sync point (Registry::Sync, the
+// end of SystemScheduler::Update, Registry::Clear).
+// ---------------------------------------------------------------------------
+struct ISignals {
+    virtual ~ISignals() = default;
+
+    // Move the component of idx (entity id) out of pool before it is removed.
+    virtual void Capture(IPool& pool, uint32_t idx, EntityId id) = 0;
+
+    // Deliver everything recorded since the last dispatch.
+    virtual void Dispatch(Registry& reg) = 0;
+
+    virtual void Disconnect(uint32_t id) = 0;
+
+    // Recreate T's pool after Registry::ReleaseMemory destroyed it, with
+    // change tracking back on while OnUpdate sinks listen.
+    virtual void Reattach(Registry& reg) = 0;
+
+    [[nodiscard]] bool WantsConstruct() const noexcept { return constructSinks > 0; }
+    [[nodiscard]] bool WantsDestroy()   const noexcept { return destroySinks > 0; }
+
+    std::vector<EntityId> constructed;      // gained T since the last dispatch
+    uint32_t              constructSinks = 0;
+    uint32_t              destroySinks   = 0;
+    uint32_t              nextId         = 1;
+    bool                  dispatching    = false; // handlers of this type are running
+};
+
+template<typename T>
+struct ComponentSignals final : ISignals {
+    using BatchFn   = std::function<void(Registry&, std::span<const EntityId>)>;
+    using DestroyFn = std::function<void(Registry&, std::span<const EntityId>, std::span<T>)>;
+
+    template<typename Fn>
+    struct Sink { uint32_t id; Fn fn; };
+
+    void Capture(IPool& pool, uint32_t idx, EntityId id) override {
+        auto& typed = static_cast<PoolFor<T>&>(pool);
+        if constexpr (IsSoAComponent<T>) destroyedValues.push_back(typed.Load(idx));
+        else                             destroyedValues.push_back(std::move(typed.Get(idx)));
+        destroyedIds.push_back(id);
+    }
+
+    void Dispatch(Registry& reg) override;   // defined after Registry
+    void Reattach(Registry& reg) override;   // defined after Registry
+
+    void Disconnect(uint32_t id) override {
+        auto drop = [id](auto& sinks) {
+            const auto it = std::find_if(sinks.begin(), sinks.end(), [id](const auto& s) { return s.id == id; });
+            if (it == sinks.end()) return false;
+            sinks.erase(it);
+            return true;
+        };
+        if (drop(onConstruct)) { --constructSinks; if (!constructSinks) constructed.clear(); return; }
+        if (drop(onUpdate))    return;
+        if (drop(onDestroy))   { --destroySinks; return; }
+    }
+
+    std::vector<Sink<BatchFn>>   onConstruct;
+    std::vector<Sink<BatchFn>>   onUpdate;
+    std::vector<Sink<DestroyFn>> onDestroy;
+
+    std::vector<EntityId> destroyedIds;     // lost T since the last dispatch...
+    std::vector<T>        destroyedValues;  // ...and the component each one had
+    uint32_t              updateSince = 0;  // change tick OnUpdate last scanned up to
+
+    // Dispatch scratch, kept to reuse capacity.
+    std::vector<EntityId> batch;
+    std::vector<EntityId> updated;
+};
+
+} // namespace detail
+} // namespace Hotones::ECS
@@ -0,0 +1,671 @@
+#pragma once
+
+#include <ECS/Registry.hpp>
+#include <ECS/Components.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// SnapshotCodec<T> — how one component is encoded in a snapshot.
+//
+// Trivially copyable components need nothing: their pools are written as
+// raw bytes, one memcpy for the entity indices and one for the data. Other
+// types, and those holding process-local values (StringId ids, handles),
+// specialise the codec with an encoder and a decoder for one element:
+//
+//   template<> struct SnapshotCodec<TagComponent> {
+//       static constexpr bool RAW = false;
+//       static void Write(const TagComponent& t, std::vector<uint8_t>& out) { PutStringId(out, t.name); }
+//       static bool Read(SnapshotReader& in, TagComponent& t)             { return in.GetStringId(t.name); }
+//   };
+//
+// Each encoded element is length-prefixed in the stream, so Read does not
+// have to consume everything it is given.
+// ---------------------------------------------------------------------------
+
+template<typename T>
+struct SnapshotCodec {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SnapshotCodec — specialise the codec for non-trivially-copyable components");
+    static constexpr bool RAW = true;
+};
+
+// Bounds-checked little helper for codec Read functions.
+class SnapshotReader {
+public:
+    SnapshotReader(const uint8_t* data, size_t size) noexcept : m_p(data), m_end(data + size) {}
+
+    // Copy n bytes out; false (and nothing read) if fewer are left.
+    bool Get(void* out, size_t n) noexcept {
+        if (size_t(m_end - m_p) < n) return false;
+        std::memcpy(out, m_p, n);
+        m_p += n;
+        return true;
+    }
+
+    template<typename V>
+    bool Get(V& value) noexcept {
+        static_assert(std::is_trivially_copyable_v<V>);
+        return Get(&value, sizeof(V));
+    }
+
+    // u32 length followed by that many bytes.
+    bool GetString(std::string& out) {
+        uint32_t n = 0;
+        if (!Get(n) || size_t(m_end - m_p) < n) return false;
+        out.assign(reinterpret_cast<const char*>(m_p), n);
+        m_p += n;
+        return true;
+    }
+
+    // A string written with PutStringId, interned again on this side.
+    bool GetStringId(StringId& out) {
+        std::string text;
+        if (!GetString(text)) return false;
+        out = StringId(text);
+        return true;
+    }
+
+    // Skip n bytes, returning where they start (nullptr if out of range).
+    const uint8_t* Take(size_t n) noexcept {
+        if (size_t(m_end - m_p) < n) return nullptr;
+        const uint8_t* at = m_p;
+        m_p += n;
+        return at;
+    }
+
+    [[nodiscard]] size_t Remaining() const noexcept { return size_t(m_end - m_p); }
+
+private:
+    const uint8_t* m_p;
+    const uint8_t* m_end;
+};
+
+inline void PutBytes(std::vector<uint8_t>& out, const void* data, size_t n) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    out.insert(out.end(), bytes, bytes + n);
+}
+
+template<typename V>
+inline void Put(std::vector<uint8_t>& out, const V& value) {
+    static_assert(std::is_trivially_copyable_v<V>);
+    PutBytes(out, &value, sizeof(V));
+}
+
+inline void PutString(std::vector<uint8_t>& out, std::string_view s) {
+    Put(out, static_cast<uint32_t>(s.size()));
+    PutBytes(out, s.data(), s.size());
+}
+
+// Interned ids differ between processes: store the text.
+inline void PutStringId(std::vector<uint8_t>& out, StringId id) { PutString(out, id.View()); }
+
+template<> struct SnapshotCodec<TagComponent> {
+    static constexpr bool RAW = false;
+    static void Write(const TagComponent& t, std::vector<uint8_t>& out) { PutStringId(out, t.name); }
+    static bool Read(SnapshotReader& in, TagComponent& t) { return in.GetStringId(t.name); }
+};
+
+template<> struct SnapshotCodec<AudioEmitterComponent> {
+    static constexpr bool RAW = false;
+    static void Write(const AudioEmitterComponent& a, std::vector<uint8_t>& out) {
+        PutStringId(out, a.soundKey);
+        Put(out, a.volume); Put(out, a.pitch); Put(out, a.maxDist);
+        Put(out, a.loop);   Put(out, a.playing); Put(out, a.autoPlay);
+    }
+    static bool Read(SnapshotReader& in, AudioEmitterComponent& a) {
+        return in.GetStringId(a.soundKey)
+            && in.Get(a.volume) && in.Get(a.pitch) && in.Get(a.maxDist)
+            && in.Get(a.loop)   && in.Get(a.playing) && in.Get(a.autoPlay);
+    }
+};
+
+// `changed` flips with every propagation pass and the struct has tail
+// padding: written raw, every parented entity would differ from any
+// baseline and be re-sent in each delta. Only the cached state is stored;
+// it reads back as changed, for the first pass after loading to publish.
+template<> struct SnapshotCodec<WorldTransformComponent> {
+    static constexpr bool RAW = false;
+    static void Write(const WorldTransformComponent& w, std::vector<uint8_t>& out) {
+        Put(out, w.matrix); Put(out, w.local); Put(out, w.parent);
+    }
+    static bool Read(SnapshotReader& in, WorldTransformComponent& w) {
+        w.changed = true;
+        return in.Get(w.matrix) && in.Get(w.local) && in.Get(w.parent);
+    }
+};
+
+// The Lua reference is process-local: it is not saved and reads back as
+// LUA_NOREF, for the script system to recreate from className.
+template<> struct SnapshotCodec<ScriptComponent> {
+    static constexpr bool RAW = false;
+    static void Write(const ScriptComponent& s, std::vector<uint8_t>& out) {
+        PutStringId(out, s.className);
+        Put(out, s.active);
+    }
+    static bool Read(SnapshotReader& in, ScriptComponent& s) {
+        s.luaRef = -1;
+        return in.GetStringId(s.className) && in.Get(s.active);
+    }
+};
+
+// ---------------------------------------------------------------------------
+// SnapshotSchema — the component types a snapshot carries, each under a
+// stable name. Component type ids depend on first-use order and cannot be
+// persisted; the name's hash identifies the section instead. Sections with
+// an unknown name are skipped on load, so adding types keeps old snapshots
+// readable.
+// ---------------------------------------------------------------------------
+
+class SnapshotSchema {
+public:
+    template<typename T>
+    SnapshotSchema& Add(std::string_view name);
+
+    // Built-in engine components that hold plain data. Components that own
+    // process-local resources (RenderModel, Billboard, ColliderSphere's
+    // physics handle, Player's controller pointer) are left out.
+    [[nodiscard]] static const SnapshotSchema& Engine();
+
+private:
+    friend class Snapshot;
+
+    struct Section;   // a parsed section of a snapshot
+
+    struct Entry {
+        uint32_t    key;
+        std::string name;
+        bool        raw;
+        uint32_t    elemSize;   // raw only
+        void (*write)(const Registry&, std::vector<uint8_t>&);
+        void (*writeDelta)(const Registry&, const Section*, const std::vector<uint32_t>& baseGen,
+                           std::vector<uint8_t>&, std::vector<uint8_t>& scratch);
+        bool (*read)(Registry&, const Section&);
+    };
+
+    [[nodiscard]] const Entry* Find(uint32_t key) const noexcept {
+        for (const Entry& e : m_entries)
+            if (e.key == key) return &e;
+        return nullptr;
+    }
+
+    std::vector<Entry> m_entries;
+};
+
+struct SnapshotSchema::Section {
+    uint32_t              key      = 0;
+    bool                  raw      = true;
+    uint32_t              elemSize = 0;
+    uint32_t              count    = 0;
+    const uint8_t*        indices  = nullptr;   // count × u32, unaligned
+    const uint8_t*        payload  = nullptr;   // raw: count × elemSize
+    std::vector<uint32_t> offsets;              // codec: count + 1 offsets into payload
+    uint32_t              removed  = 0;
+    const uint8_t*        removedIdx = nullptr; // removed × u32 (deltas)
+
+    [[nodiscard]] uint32_t Index(uint32_t i) const noexcept {
+        uint32_t v; std::memcpy(&v, indices + size_t(i) * 4, 4); return v;
+    }
+    [[nodiscard]] std::span<const uint8_t> Element(uint32_t i) const noexcept {
+        if (raw) return { payload + size_t(i) * elemSize, elemSize };
+        return { payload + offsets[i] + 4, offsets[i + 1] - offsets[i] - 4 };
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Snapshot — binary save / load of a Registry.
+//
+//   std::vector<uint8_t> bytes;
+//   Snapshot::Write(reg, SnapshotSchema::Engine(), bytes);      // full
+//   Snapshot::Read (other, SnapshotSchema::Engine(), bytes);    // other == reg
+//
+//   Snapshot::WriteDelta(reg, schema, baseline, delta);         // reg vs baseline
+//   Snapshot::ApplyDelta(mirror, schema, delta);                // mirror: baseline → reg
+//
+// A full snapshot restores the entity table exactly (ids, generations, free
+// list), so ids stored in components (ParentComponent, game code) stay
+// valid and later CreateEntity calls hand out the same ids as the source
+// would have.
+//
+// A delta lists the entities created and destroyed since the baseline, and
+// per component type the components added or whose bytes changed, plus the
+// ones removed from entities that survive. It applies onto a registry that
+// is in the baseline's state. It does not carry the free list.
+//
+// Layout (native byte order, no padding):
+//   u32 magic, u16 version, u16 kind (0 full, 1 delta)
+//   full : u32 slots, u32 generations[slots], u32 alive, u32 ids[alive],
+//          u32 free, u32 freeList[free]
+//   delta: u32 destroyed, u32 ids[], u32 created, u32 ids[]
+//   u32 sections, then per section:
+//          u32 key, u32 raw, u32 elemSize, u32 count, u32 entityIdx[count],
+//          raw: count × elemSize bytes | codec: count × (u32 len, bytes),
+//          u32 removed, u32 entityIdx[removed]
+//
+// Read / ApplyDelta validate every length and return false on malformed
+// input; Read leaves the registry cleared in that case.
+// ---------------------------------------------------------------------------
+
+class Snapshot {
+public:
+    static constexpr uint32_t MAGIC   = 0x53434548u;   // "HECS"
+    static constexpr uint16_t VERSION = 2;
+
+    static void Write(const Registry& reg, const SnapshotSchema& schema, std::vector<uint8_t>& out);
+    static bool Read(Registry& reg, const SnapshotSchema& schema, std::span<const uint8_t> bytes);
+
+    // baseline must be a full snapshot.
+    static bool WriteDelta(const Registry& reg, const SnapshotSchema& schema,
+                           std::span<const uint8_t> baseline, std::vector<uint8_t>& out);
+    static bool ApplyDelta(Registry& reg, const SnapshotSchema& schema, std::span<const uint8_t> delta);
+
+private:
+    friend class SnapshotSchema;
+    using Section = SnapshotSchema::Section;
+
+    enum Kind : uint16_t { FULL = 0, DELTA = 1 };
+
+    struct Parsed {
+        uint16_t              kind  = FULL;
+        uint32_t              slots = 0;
+        const uint8_t*        generations = nullptr;
+        uint32_t              alive = 0;
+        const uint8_t*        aliveIds = nullptr;
+        uint32_t              free  = 0;
+        const uint8_t*        freeList = nullptr;
+        uint32_t              destroyed = 0, created = 0;
+        const uint8_t*        destroyedIds = nullptr;
+        const uint8_t*        createdIds   = nullptr;
+        std::vector<Section>  sections;
+    };
+
+    static uint32_t U32(const uint8_t* p, size_t i) noexcept {
+        uint32_t v; std::memcpy(&v, p + i * 4, 4); return v;
+    }
+
+    static bool Parse(std::span<const uint8_t> bytes, Parsed& out);
+    static void WriteHeader(std::vector<uint8_t>& out, Kind kind);
+    static void WriteEntities(const Registry& reg, std::vector<uint8_t>& out);
+
+    template<typename T> static void WriteSection(const Registry& reg, std::vector<uint8_t>& out);
+    template<typename T> static void WriteDeltaSection(const Registry& reg, const Section* base,
+                                                       const std::vector<uint32_t>& baseGen,
+                                                       std::vector<uint8_t>& out,
+                                                       std::vector<uint8_t>& scratch);
+    template<typename T> static bool ReadSection(Registry& reg, const Section& section);
+    template<typename T> static bool Decode(const Section& section, uint32_t i, T& value);
+};
+
+// ---------------------------------------------------------------------------
+// Implementation
+// ---------------------------------------------------------------------------
+
+namespace detail {
+// FNV-1a, used for stable section keys.
+[[nodiscard]] constexpr uint32_t Fnv1a(std::string_view s) noexcept {
+    uint32_t h = 2166136261u;
+    for (const char c : s) { h ^= static_cast<uint8_t>(c); h *= 16777619u; }
+    return h;
+}
+} // namespace detail
+
+template<typename T>
+SnapshotSchema& SnapshotSchema::Add(std::string_view name) {
+    static_assert(AllAoSComponents<T>, "SnapshotSchema — SoA components are not supported");
+    const uint32_t key = detail::Fnv1a(name);
+    assert(!Find(key) && "SnapshotSchema::Add — name already used (or hash collision)");
+    m_entries.push_back({ key, std::string(name), SnapshotCodec<T>::RAW,
+                          SnapshotCodec<T>::RAW ? uint32_t(sizeof(T)) : 0u,
+                          &Snapshot::WriteSection<T>, &Snapshot::WriteDeltaSection<T>,
+                          &Snapshot::ReadSection<T> });
+    return *this;
+}
+
+inline const SnapshotSchema& SnapshotSchema::Engine() {
+    static const SnapshotSchema s_schema = [] {
+        SnapshotSchema s;
+        s.Add<TransformComponent>("Transform")
+         .Add<VelocityComponent>("Velocity")
+         .Add<ParentComponent>("Parent")
+         .Add<ChildrenComponent>("Children")
+         .Add<WorldTransformComponent>("WorldTransform")
+         .Add<TagComponent>("Tag")
+         .Add<GroupComponent>("Group")
+         .Add<HealthComponent>("Health")
+         .Add<LifetimeComponent>("Lifetime")
+         .Add<NetworkComponent>("Network")
+         .Add<AudioEmitterComponent>("AudioEmitter")
+         .Add<ScriptComponent>("Script");
+        return s;
+    }();
+    return s_schema;
+}
+
+inline void Snapshot::WriteHeader(std::vector<uint8_t>& out, Kind kind) {
+    Put(out, MAGIC);
+    Put(out, VERSION);
+    Put(out, static_cast<uint16_t>(kind));
+}
+
+inline void Snapshot::WriteEntities(const Registry& reg, std::vector<uint8_t>& out) {
+    Put(out, static_cast<uint32_t>(reg.m_generations.size()));
+    PutBytes(out, reg.m_generations.data(), reg.m_generations.size() * 4);
+    Put(out, static_cast<uint32_t>(reg.m_alive.size()));
+    PutBytes(out, reg.m_alive.data(), reg.m_alive.size() * 4);
+    auto freeList = reg.m_freeList;   // std::queue cannot be walked in place
+    Put(out, static_cast<uint32_t>(freeList.size()));
+    for (; !freeList.empty(); freeList.pop()) Put(out, freeList.front());
+}
+
+inline void Snapshot::Write(const Registry& reg, const SnapshotSchema& schema, std::vector<uint8_t>& out) {
+    out.clear();
+    WriteHeader(out, FULL);
+    WriteEntities(reg, out);
+
+    const size_t countAt = out.size();
+    Put(out, uint32_t{0});
+    uint32_t sections = 0;
+    for (const auto& entry : schema.m_entries) {
+        const size_t before = out.size();
+        entry.write(reg, out);
+        if (out.size() == before) continue;
+        std::memcpy(out.data() + before, &entry.key, 4);
+        ++sections;
+    }
+    std::memcpy(out.data() + countAt, &sections, 4);
+}
+
+template<typename T>
+void Snapshot::WriteSection(const Registry& reg, std::vector<uint8_t>& out) {
+    const ComponentPool<T>* pool = reg.PoolPtr<T>();
+    if (!pool || pool->Size() == 0) return;
+    const uint32_t count = static_cast<uint32_t>(pool->Size());
+
+    Put(out, uint32_t{0});   // key, patched by the caller
+    Put(out, uint32_t(SnapshotCodec<T>::RAW));
+    Put(out, SnapshotCodec<T>::RAW ? uint32_t(sizeof(T)) : 0u);
+    Put(out, count);
+    PutBytes(out, pool->EntityIndices().data(), size_t(count) * 4);
+    if constexpr (SnapshotCodec<T>::RAW) {
+        PutBytes(out, pool->Components().data(), size_t(count) * sizeof(T));
+    } else {
+        for (const T& value : pool->Components()) {
+            const size_t lenAt = out.size();
+            Put(out, uint32_t{0});
+            SnapshotCodec<T>::Write(value, out);
+            const uint32_t len = static_cast<uint32_t>(out.size() - lenAt - 4);
+            std::memcpy(out.data() + lenAt, &len, 4);
+        }
+    }
+    Put(out, uint32_t{0});   // removed
+}
+
+inline bool Snapshot::Parse(std::span<const uint8_t> bytes, Parsed& out) {
+    SnapshotReader in(bytes.data(), bytes.size());
+    uint32_t magic = 0; uint16_t version = 0, kind = 0;
+    if (!in.Get(magic) || !in.Get(version) || !in.Get(kind)) return false;
+    if (magic != MAGIC || version != VERSION || kind > DELTA) return false;
+    out.kind = kind;
+
+    auto ids = [&](uint32_t& n, const uint8_t*& at) {
+        return in.Get(n) && (at = in.Take(size_t(n) * 4)) != nullptr;
+    };
+    if (kind == FULL) {
+        if (!ids(out.slots, out.generations) || !ids(out.alive, out.aliveIds)
+            || !ids(out.free, out.freeList)) return false;
+    } else {
+        if (!ids(out.destroyed, out.destroyedIds) || !ids(out.created, out.createdIds)) return false;
+    }
+
+    uint32_t sections = 0;
+    if (!in.Get(sections)) return false;
+    out.sections.clear();
+    out.sections.resize(sections);
+    for (Section& s : out.sections) {
+        uint32_t raw = 0;
+        if (!in.Get(s.key) || !in.Get(raw) || !in.Get(s.elemSize) || raw > 1) return false;
+        s.raw = raw != 0;
+        if (!ids(s.count, s.indices)) return false;
+        if (s.raw) {
+            if (!(s.payload = in.Take(size_t(s.count) * s.elemSize)) && s.count) return false;
+        } else {
+            s.payload = in.Take(0);
+            s.offsets.resize(size_t(s.count) + 1);
+            uint32_t offset = 0;
+            for (uint32_t i = 0; i < s.count; ++i) {
+                s.offsets[i] = offset;
+                uint32_t len = 0;
+                if (!in.Get(len) || !in.Take(len)) return false;
+                offset += 4 + len;
+            }
+            s.offsets[s.count] = offset;
+        }
+        if (!ids(s.removed, s.removedIdx)) return false;
+    }
+    return in.Remaining() == 0;
+}
+
+template<typename T>
+bool Snapshot::Decode(const Section& section, uint32_t i, T& value) {
+    const std::span<const uint8_t> bytes = section.Element(i);
+    if constexpr (SnapshotCodec<T>::RAW) {
+        if (bytes.size() != sizeof(T)) return false;
+        std::memcpy(&value, bytes.data(), sizeof(T));
+        return true;
+    } else {
+        SnapshotReader in(bytes.data(), bytes.size());
+        return SnapshotCodec<T>::Read(in, value);
+    }
+}
+
+template<typename T>
+bool Snapshot::ReadSection(Registry& reg, const Section& section) {
+    if (section.raw != SnapshotCodec<T>::RAW) return false;
+    if (section.raw && section.elemSize != sizeof(T)) return false;
+    reg.template Pool<T>().Reserve(reg.template Pool<T>().Size() + section.count);
+
+    for (uint32_t i = 0; i < section.count; ++i) {
+        const uint32_t idx = section.Index(i);
+        if (!reg.SlotAlive(idx)) return false;
+        const EntityId id = MakeEntity(idx, reg.m_generations[idx]);
+        T value{};
+        if (!Decode(section, i, value)) return false;
+        if (reg.HasComponent<T>(id)) reg.GetComponent<T>(id) = std::move(value);
+        else                         reg.AddComponent<T>(id, std::move(value));
+    }
+    for (uint32_t i = 0; i < section.removed; ++i) {
+        const uint32_t idx = U32(section.removedIdx, i);
+        if (!reg.SlotAlive(idx)) return false;
+        reg.RemoveComponent<T>(MakeEntity(idx, reg.m_generations[idx]));
+    }
+    return true;
+}
+
+inline bool Snapshot::Read(Registry& reg, const SnapshotSchema& schema, std::span<const uint8_t> bytes) {
+    assert(!reg.IsIterating() && "Snapshot::Read — called from inside a View / Each");
+    reg.Clear();
+    Parsed snap;
+    if (!Parse(bytes, snap) || snap.kind != FULL) return false;
+
+    reg.m_generations.resize(snap.slots);
+    std::memcpy(reg.m_generations.data(), snap.generations, size_t(snap.slots) * 4);
+    reg.m_signatures.assign(snap.slots, ComponentMask{});
+    reg.m_alivePos.assign(snap.slots, 0u);
+    reg.m_alive.resize(snap.alive);
+    std::memcpy(reg.m_alive.data(), snap.aliveIds, size_t(snap.alive) * 4);
+    // Every slot is alive once or free once at most: a duplicate alive id
+    // would corrupt the alive list, a free slot that is alive (or listed
+    // twice) would be handed out again while in use.
+    std::vector<uint8_t> claimed(snap.slots, 0u);
+    for (uint32_t pos = 0; pos < snap.alive; ++pos) {
+        const EntityId id  = reg.m_alive[pos];
+        const uint32_t idx = EntityIndex(id);
+        if (idx >= snap.slots || reg.m_generations[idx] != EntityGeneration(id) || claimed[idx]) {
+            reg.Clear();
+            return false;
+        }
+        claimed[idx]        = 1u;
+        reg.m_alivePos[idx] = pos;
+    }
+    for (uint32_t i = 0; i < snap.free; ++i) {
+        const uint32_t idx = U32(snap.freeList, i);
+        if (idx >= snap.slots || claimed[idx]) { reg.Clear(); return false; }
+        claimed[idx] = 1u;
+        reg.m_freeList.push(idx);
+    }
+
+    for (const Section& section : snap.sections) {
+        const SnapshotSchema::Entry* entry = schema.Find(section.key);
+        if (entry && !entry->read(reg, section)) { reg.Clear(); return false; }
+    }
+    return true;
+}
+
+template<typename T>
+void Snapshot::WriteDeltaSection(const Registry& reg, const Section* base,
+                                 const std::vector<uint32_t>& baseGen,
+                                 std::vector<uint8_t>& out, std::vector<uint8_t>& scratch) {
+    const ComponentPool<T>* pool = reg.PoolPtr<T>();
+    const uint32_t count = pool ? static_cast<uint32_t>(pool->Size()) : 0u;
+    if (count == 0 && (!base || base->count == 0)) return;
+
+    // baseline entity index → element, for entities that still exist.
+    constexpr uint32_t NONE = 0xFFFFFFFFu;
+    std::vector<uint32_t> baseAt;
+    if (base) {
+        baseAt.assign(baseGen.size(), NONE);
+        for (uint32_t i = 0; i < base->count; ++i) {
+            const uint32_t idx = base->Index(i);
+            if (idx < baseAt.size()) baseAt[idx] = i;
+        }
+    }
+    auto sameEntity = [&](uint32_t idx) {   // alive now with the baseline's generation
+        return idx < baseGen.size() && baseGen[idx] != NONE && reg.IsAlive(MakeEntity(idx, baseGen[idx]));
+    };
+
+    // Changed / added components.
+    static const std::pmr::vector<uint32_t> s_none;
+    const std::pmr::vector<uint32_t>& dense = pool ? pool->EntityIndices() : s_none;
+    std::vector<uint32_t> upserts;
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t idx = dense[i];
+        const uint32_t b   = (base && sameEntity(idx)) ? baseAt[idx] : NONE;
+        if (b == NONE) { upserts.push_back(i); continue; }
+        const std::span<const uint8_t> old = base->Element(b);
+        const T& value = pool->Components()[i];
+        if constexpr (SnapshotCodec<T>::RAW) {
+            if (std::memcmp(&value, old.data(), sizeof(T)) != 0) upserts.push_back(i);
+        } else {
+            scratch.clear();
+            SnapshotCodec<T>::Write(value, scratch);
+            if (scratch.size() != old.size() || std::memcmp(scratch.data(), old.data(), old.size()) != 0)
+                upserts.push_back(i);
+        }
+    }
+
+    // Removed from entities that survive.
+    std::vector<uint32_t> removed;
+    if (base)
+        for (uint32_t i = 0; i < base->count; ++i) {
+            const uint32_t idx = base->Index(i);
+            if (sameEntity(idx) && !(pool && pool->Has(idx))) removed.push_back(idx);
+        }
+
+    if (upserts.empty() && removed.empty()) return;
+    Put(out, uint32_t{0});   // key, patched by the caller
+    Put(out, uint32_t(SnapshotCodec<T>::RAW));
+    Put(out, SnapshotCodec<T>::RAW ? uint32_t(sizeof(T)) : 0u);
+    Put(out, static_cast<uint32_t>(upserts.size()));
+    for (const uint32_t i : upserts) Put(out, dense[i]);
+    for (const uint32_t i : upserts) {
+        const T& value = pool->Components()[i];
+        if constexpr (SnapshotCodec<T>::RAW) {
+            Put(out, value);
+        } else {
+            const size_t lenAt = out.size();
+            Put(out, uint32_t{0});
+            SnapshotCodec<T>::Write(value, out);
+            const uint32_t len = static_cast<uint32_t>(out.size() - lenAt - 4);
+            std::memcpy(out.data() + lenAt, &len, 4);
+        }
+    }
+    Put(out, static_cast<uint32_t>(removed.size()));
+    PutBytes(out, removed.data(), removed.size() * 4);
+}
+
+inline bool Snapshot::WriteDelta(const Registry& reg, const SnapshotSchema& schema,
+                                 std::span<const uint8_t> baseline, std::vector<uint8_t>& out) {
+    Parsed base;
+    if (!Parse(baseline, base) || base.kind != FULL) return false;
+
+    // Generation of every entity alive in the baseline, by index.
+    constexpr uint32_t NONE = 0xFFFFFFFFu;
+    std::vector<uint32_t> baseGen(base.slots, NONE);
+    for (uint32_t i = 0; i < base.alive; ++i) {
+        const EntityId id = U32(base.aliveIds, i);
+        if (EntityIndex(id) < base.slots) baseGen[EntityIndex(id)] = EntityGeneration(id);
+    }
+    // Current slots the baseline never had count as not-alive there.
+    if (baseGen.size() < reg.m_generations.size()) baseGen.resize(reg.m_generations.size(), NONE);
+
+    out.clear();
+    WriteHeader(out, DELTA);
+
+    const size_t destroyedAt = out.size();
+    Put(out, uint32_t{0});
+    uint32_t destroyed = 0;
+    for (uint32_t i = 0; i < base.alive; ++i) {
+        const EntityId id = U32(base.aliveIds, i);
+        if (!reg.IsAlive(id)) { Put(out, id); ++destroyed; }
+    }
+    std::memcpy(out.data() + destroyedAt, &destroyed, 4);
+
+    const size_t createdAt = out.size();
+    Put(out, uint32_t{0});
+    uint32_t created = 0;
+    for (const EntityId id : reg.m_alive)
+        if (baseGen[EntityIndex(id)] != EntityGeneration(id)) { Put(out, id); ++created; }
+    std::memcpy(out.data() + createdAt, &created, 4);
+
+    const size_t countAt = out.size();
+    Put(out, uint32_t{0});
+    uint32_t sections = 0;
+    std::vector<uint8_t> scratch;
+    for (const auto& entry : schema.m_entries) {
+        const Section* section = nullptr;
+        for (const Section& s : base.sections)
+            if (s.key == entry.key) { section = &s; break; }
+        const size_t before = out.size();
+        entry.writeDelta(reg, section, baseGen, out, scratch);
+        if (out.size() == before) continue;
+        std::memcpy(out.data() + before, &entry.key, 4);
+        ++sections;
+    }
+    std::memcpy(out.data() + countAt, &sections, 4);
+    return true;
+}
+
+inline bool Snapshot::ApplyDelta(Registry& reg, const SnapshotSchema& schema, std::span<const uint8_t> delta) {
+    assert(!reg.IsIterating() && "Snapshot::ApplyDelta — called from inside a View / Each");
+    Parsed snap;
+    if (!Parse(delta, snap) || snap.kind != DELTA) return false;
+
+    for (uint32_t i = 0; i < snap.destroyed; ++i) reg.DestroyEntity(U32(snap.destroyedIds, i));
+    for (uint32_t i = 0; i < snap.created; ++i) reg.CreateEntityWithId(U32(snap.createdIds, i));
+
+    for (const Section& section : snap.sections) {
+        const SnapshotSchema::Entry* entry = schema.Find(section.key);
+        if (entry && !entry->read(reg, section)) return false;
+    }
+    return true;
+}
+
+} // namespace Hotones::ECS
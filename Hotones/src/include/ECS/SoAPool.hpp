@@ -0,0 +1,210 @@
+#pragma once
+
+#include <ECS/ComponentPool.hpp>
+
+#include <array>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// UseSoAStorage<T> — opt a component type into structure-of-arrays storage.
+//
+//   struct ParticleVelocity { float x, y, z; };
+//   template<> struct Hotones::ECS::UseSoAStorage<ParticleVelocity> : std::true_type {};
+//
+// The Registry then keeps T in a SoAPool<T> instead of a ComponentPool<T>.
+// Such components have no address, so the reference-returning API
+// (GetComponent, View, Each, Group) does not accept them. Read and write
+// them through Registry::Pool<T>(): Load / Store per entity, or the raw
+// float streams for whole-pool kernels.
+// ---------------------------------------------------------------------------
+template<typename T>
+struct UseSoAStorage : std::false_type {};
+
+template<typename T>
+inline constexpr bool IsSoAComponent = UseSoAStorage<std::remove_cv_t<T>>::value;
+
+// ---------------------------------------------------------------------------
+// SoAPool<T> — sparse-set storage that splits T into float streams.
+//
+// T must be trivially copyable and made only of float members (Vector3,
+// Quaternion, a struct of floats...). Word k of every component lives in
+// Stream(k), packed in dense order, so a kernel touching only x/y/z walks
+// three contiguous float arrays instead of striding over whole structs.
+//
+//   auto& pool = reg.Pool<ParticleVelocity>();
+//   float* x = pool.Stream(0);   // pool.Size() floats each
+//   float* y = pool.Stream(1);
+//
+// The sparse / dense bookkeeping is the same as ComponentPool<T>; only the
+// data array differs.
+// ---------------------------------------------------------------------------
+template<typename T>
+class SoAPool : public IPool {
+    static_assert(std::is_trivially_copyable_v<T>, "SoAPool requires a trivially copyable component");
+    static_assert(sizeof(T) % sizeof(float) == 0 && alignof(T) <= alignof(float),
+                  "SoAPool requires a component made only of float members");
+
+public:
+    // Number of float streams (words per component).
+    static constexpr size_t STREAMS = sizeof(T) / sizeof(float);
+
+    explicit SoAPool(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : m_sparse(resource), m_dense(resource),
+          m_streams(MakeStreams(resource, std::make_index_sequence<STREAMS>{})) {}
+
+    // ---- IPool interface ------------------------------------------------
+
+    void Remove(uint32_t entityIdx) override {
+        if (!Has(entityIdx)) return;
+
+        const uint32_t denseIdx = m_sparse.Ref(entityIdx);
+        const uint32_t last     = static_cast<uint32_t>(m_dense.size()) - 1u;
+
+        if (denseIdx != last) {
+            const uint32_t lastEntityIdx = m_dense[last];
+            m_dense[denseIdx]            = lastEntityIdx;
+            for (auto& stream : m_streams) stream[denseIdx] = stream[last];
+            m_sparse.Ref(lastEntityIdx)  = denseIdx;
+        }
+
+        m_dense.pop_back();
+        for (auto& stream : m_streams) stream.pop_back();
+        m_sparse.Release(entityIdx);
+    }
+
+    void Clear() override {
+        m_sparse.Clear();
+        m_dense.clear();
+        for (auto& stream : m_streams) stream.clear();
+    }
+
+    [[nodiscard]] size_t Size() const override { return m_dense.size(); }
+
+    [[nodiscard]] const std::pmr::vector<uint32_t>& EntityIndices() const override {
+        return m_dense;
+    }
+
+    [[nodiscard]] PoolMemoryStats MemoryStats() const override {
+        PoolMemoryStats stats;
+        stats.type        = ComponentType<T>();
+        stats.typeName    = typeid(T).name();
+        stats.count       = m_dense.size();
+        stats.sparseBytes = m_sparse.MemoryBytes();
+        stats.denseBytes  = m_dense.capacity() * sizeof(uint32_t);
+        for (const auto& stream : m_streams) stats.dataBytes += stream.capacity() * sizeof(float);
+        return stats;
+    }
+
+    [[nodiscard]] bool Contains(uint32_t entityIdx) const override { return Has(entityIdx); }
+
+    [[nodiscard]] uint32_t DenseIndex(uint32_t entityIdx) const override {
+        assert(Has(entityIdx) && "SoAPool::DenseIndex — entity does not own this component");
+        return m_sparse.Ref(entityIdx);
+    }
+
+    void SwapDense(uint32_t a, uint32_t b) override {
+        if (a == b) return;
+        using std::swap;
+        swap(m_dense[a], m_dense[b]);
+        for (auto& stream : m_streams) swap(stream[a], stream[b]);
+        m_sparse.Ref(m_dense[a]) = a;
+        m_sparse.Ref(m_dense[b]) = b;
+    }
+
+    void Permute(uint32_t begin, std::span<const uint32_t> order) override {
+        detail::GatherRange(m_dense, begin, order);
+        for (auto& stream : m_streams) detail::GatherRange(stream, begin, order);
+        const uint32_t end = begin + static_cast<uint32_t>(order.size());
+        for (uint32_t i = begin; i < end; ++i) m_sparse.Ref(m_dense[i]) = i;
+    }
+
+    // SoA components are never change-tracked.
+    [[nodiscard]] bool TracksChanges() const noexcept override { return false; }
+
+    [[nodiscard]] std::unique_ptr<IPool> MakeEmpty() const override {
+        return std::make_unique<SoAPool>(m_dense.get_allocator().resource());
+    }
+
+    // ---- Typed interface ------------------------------------------------
+
+    [[nodiscard]] bool Has(uint32_t entityIdx) const { return m_sparse.Has(entityIdx); }
+
+    // Make room for n components in total (bulk loads). Grows at least
+    // geometrically, like ComponentPool::Reserve.
+    void Reserve(size_t n) {
+        if (n <= m_dense.capacity()) return;
+        n = std::max(n, m_dense.capacity() * 2);
+        for (auto& stream : m_streams) stream.reserve(n);
+        m_dense.reserve(n);
+    }
+
+    // Append value for entityIdx. Asserts the entity does not own a T yet.
+    void Emplace(uint32_t entityIdx, const T& value = T{}) {
+        assert(!Has(entityIdx) && "SoAPool::Emplace — entity already owns this component");
+        const uint32_t denseIdx = static_cast<uint32_t>(m_dense.size());
+        const auto words = ToWords(value);
+        for (size_t k = 0; k < STREAMS; ++k) m_streams[k].push_back(words[k]);
+        m_dense.push_back(entityIdx);
+        m_sparse.Acquire(entityIdx) = denseIdx;
+    }
+
+    // Gather the component of entityIdx into a T.
+    [[nodiscard]] T Load(uint32_t entityIdx) const {
+        assert(Has(entityIdx) && "SoAPool::Load — entity does not own this component");
+        const uint32_t i = m_sparse.Ref(entityIdx);
+        std::array<float, STREAMS> words;
+        for (size_t k = 0; k < STREAMS; ++k) words[k] = m_streams[k][i];
+        T value;
+        std::memcpy(&value, words.data(), sizeof(T));
+        return value;
+    }
+
+    // Scatter value into the streams of entityIdx.
+    void Store(uint32_t entityIdx, const T& value) {
+        assert(Has(entityIdx) && "SoAPool::Store — entity does not own this component");
+        const uint32_t i = m_sparse.Ref(entityIdx);
+        const auto words = ToWords(value);
+        for (size_t k = 0; k < STREAMS; ++k) m_streams[k][i] = words[k];
+    }
+
+    // Word k of every component, Size() floats in dense order.
+    // Invalidated by any add / remove on this pool.
+    [[nodiscard]] float*       Stream(size_t k)       { return m_streams[k].data(); }
+    [[nodiscard]] const float* Stream(size_t k) const { return m_streams[k].data(); }
+
+private:
+    using Streams = std::array<std::pmr::vector<float>, STREAMS>;
+
+    template<size_t... K>
+    [[nodiscard]] static Streams MakeStreams(std::pmr::memory_resource* resource, std::index_sequence<K...>) {
+        return { ((void)K, std::pmr::vector<float>(resource))... };
+    }
+
+    [[nodiscard]] static std::array<float, STREAMS> ToWords(const T& value) {
+        std::array<float, STREAMS> words;
+        std::memcpy(words.data(), &value, sizeof(T));
+        return words;
+    }
+
+    SparseIndex                m_sparse;  // entityIdx → denseIdx
+    std::pmr::vector<uint32_t> m_dense;   // dense[i] → entityIdx
+    Streams                    m_streams; // streams[k][i] → word k of dense[i]
+};
+
+// Storage used for component type T: SoAPool<T> if T opted in through
+// UseSoAStorage, ComponentPool<T> otherwise. PoolFor<const T> is the pool
+// of T.
+template<typename T>
+using PoolFor = std::conditional_t<IsSoAComponent<T>,
+                                   SoAPool<std::remove_const_t<T>>,
+                                   ComponentPool<std::remove_const_t<T>>>;
+
+// True if none of Ts uses SoA storage (i.e. all can be handed out as T&).
+template<typename... Ts>
+inline constexpr bool AllAoSComponents = (!IsSoAComponent<Ts> && ...);
+
+} // namespace Hotones::ECS
@@ -0,0 +1,291 @@
+#pragma once
+
+#include <ECS/System.hpp>
+#include <ECS/Registry.hpp>
+#include <ECS/Components.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// SpatialIndexSystem — proximity queries over entities that have both a
+// TransformComponent and a ColliderSphereComponent.
+//
+//   auto& spatial = systems.Add<SpatialIndexSystem>();   // after movers and
+//   ...                                                  // TransformPropagation
+//   std::vector<EntityId> hits;                          // reuse across calls
+//   spatial.QuerySphere(pos, 10.0f, hits);
+//   spatial.Nearest(pos, 4, hits);
+//
+// Storage is a loose uniform grid: each entity sits in the one hashed cell
+// containing its centre, and queries widen their cell range by the largest
+// collider radius seen. Cells are created on demand, so the world has no
+// bounds to configure, only a cell size (a few times a typical radius).
+//
+// Update() is incremental: it reads the registry's change ticks and only
+// re-files entities whose TransformComponent, WorldTransformComponent or
+// ColliderSphereComponent was written since the previous update. Moving
+// within a cell costs one store. Entities losing their collider (or being
+// destroyed) are dropped by an OnDestroy observer at the next sync point.
+//
+// Positions come from WorldTransformComponent when the entity has one
+// (hierarchy members), TransformComponent::position otherwise. Queries see
+// the state as of the last Update(); they are const and may run
+// concurrently with each other.
+// ---------------------------------------------------------------------------
+
+class SpatialIndexSystem : public System {
+public:
+    explicit SpatialIndexSystem(float cellSize = 8.0f) noexcept : m_cellSize(cellSize), m_invCell(1.0f / cellSize) {}
+
+    void DeclareAccess(SystemAccess& access) const override {
+        access.Reads<TransformComponent, WorldTransformComponent, ColliderSphereComponent>();
+    }
+
+    void Init(Registry& reg) override {
+        m_since = 0;
+        reg.TrackChanges<TransformComponent>();
+        reg.TrackChanges<WorldTransformComponent>();
+        reg.TrackChanges<ColliderSphereComponent>();
+        m_onDestroy = reg.OnDestroy<ColliderSphereComponent>(
+            [this](Registry&, std::span<const EntityId> ids, std::span<ColliderSphereComponent>) {
+                for (const EntityId id : ids) Remove(id);
+            });
+    }
+
+    void Update(Registry& reg, float /*dt*/) override {
+        const uint32_t since = m_since;
+        m_since = reg.AdvanceTick();
+        auto refile = [&](EntityId e) { Refile(reg, e); };
+        reg.ViewChanged<ColliderSphereComponent>(since, [&](EntityId e, const ColliderSphereComponent&) { refile(e); });
+        reg.ViewChanged<TransformComponent>(since,      [&](EntityId e, const TransformComponent&)      { refile(e); });
+        reg.ViewChanged<WorldTransformComponent>(since, [&](EntityId e, const WorldTransformComponent&) { refile(e); });
+    }
+
+    void Shutdown(Registry& reg) override {
+        reg.Disconnect(m_onDestroy);
+        m_onDestroy = {};
+        m_items.clear();
+        m_itemOf.clear();
+        m_cells.clear();
+        m_maxRadius = 0.0f;
+    }
+
+    [[nodiscard]] const char* Name() const override { return "SpatialIndexSystem"; }
+
+    [[nodiscard]] size_t Size() const noexcept { return m_items.size(); }
+
+    // ---- Queries ------------------------------------------------------------
+    // Each clears `out` and fills it; pass the same vector every time to
+    // avoid allocating.
+
+    // Entities whose collider sphere overlaps the sphere (center, radius).
+    void QuerySphere(Vector3 center, float radius, std::vector<EntityId>& out) const {
+        out.clear();
+        const Vector3 r = { radius, radius, radius };
+        ForEachCandidate(Vector3Subtract(center, r), Vector3Add(center, r), [&](const Item& item) {
+            const float reach = radius + item.radius;
+            if (DistanceSq(item.pos, center) <= reach * reach) out.push_back(item.id);
+        });
+    }
+
+    // Entities whose collider sphere overlaps box.
+    void QueryAABB(const BoundingBox& box, std::vector<EntityId>& out) const {
+        out.clear();
+        ForEachCandidate(box.min, box.max, [&](const Item& item) {
+            const Vector3 closest = {
+                std::clamp(item.pos.x, box.min.x, box.max.x),
+                std::clamp(item.pos.y, box.min.y, box.max.y),
+                std::clamp(item.pos.z, box.min.z, box.max.z),
+            };
+            if (DistanceSq(item.pos, closest) <= item.radius * item.radius) out.push_back(item.id);
+        });
+    }
+
+    // The k entities whose centres are closest to point, nearest first.
+    void Nearest(Vector3 point, size_t k, std::vector<EntityId>& out) const {
+        out.clear();
+        if (k == 0 || m_items.empty()) return;
+
+        // Max-heap on distance keeps the best k seen so far.
+        std::vector<std::pair<float, EntityId>> best;
+        best.reserve(std::min(k, m_items.size()) + 1u);
+        auto consider = [&](const Item& item) {
+            const float d = DistanceSq(item.pos, point);
+            if (best.size() == k && d >= best.front().first) return;
+            best.emplace_back(d, item.id);
+            std::push_heap(best.begin(), best.end());
+            if (best.size() > k) { std::pop_heap(best.begin(), best.end()); best.pop_back(); }
+        };
+
+        // Walk cubic rings of cells outwards. Everything in ring r is at
+        // least (r - 1) cells away, which bounds the search. Once a ring
+        // would visit more cells than exist, scanning every item is cheaper.
+        const Cell c = CellOf(point);
+        for (int32_t r = 0;; ++r) {
+            if (best.size() == k) {
+                const float bound = static_cast<float>(r - 1) * m_cellSize;
+                if (r > 0 && bound * bound >= best.front().first) break;
+            }
+            const uint64_t side = 2u * static_cast<uint64_t>(r) + 1u;
+            if (side * side * side > 4u * m_cells.size() + 27u) {
+                best.clear();
+                for (const Item& item : m_items) consider(item);
+                break;
+            }
+            for (int32_t dx = -r; dx <= r; ++dx)
+            for (int32_t dy = -r; dy <= r; ++dy)
+            for (int32_t dz = -r; dz <= r; ++dz) {
+                if (std::max({ std::abs(dx), std::abs(dy), std::abs(dz) }) != r) continue;
+                const auto it = m_cells.find(Key({ c.x + dx, c.y + dy, c.z + dz }));
+                if (it == m_cells.end()) continue;
+                for (const uint32_t i : it->second) consider(m_items[i]);
+            }
+        }
+
+        std::sort_heap(best.begin(), best.end());
+        out.reserve(best.size());
+        for (const auto& [d, id] : best) out.push_back(id);
+    }
+
+private:
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    struct Cell { int32_t x, y, z; };
+
+    struct Item {
+        EntityId id;
+        Vector3  pos;
+        float    radius;
+        uint64_t cell;
+        uint32_t slot;     // position in m_cells[cell]
+    };
+
+    [[nodiscard]] static float DistanceSq(Vector3 a, Vector3 b) noexcept {
+        const float dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    [[nodiscard]] Cell CellOf(Vector3 p) const noexcept {
+        return { static_cast<int32_t>(std::floor(p.x * m_invCell)),
+                 static_cast<int32_t>(std::floor(p.y * m_invCell)),
+                 static_cast<int32_t>(std::floor(p.z * m_invCell)) };
+    }
+
+    // 21 bits per axis; far-apart cells may share a key, which only adds
+    // candidates that the exact tests reject.
+    [[nodiscard]] static uint64_t Key(Cell c) noexcept {
+        constexpr uint64_t mask = (1u << 21) - 1u;
+        return ((static_cast<uint64_t>(c.x) & mask) << 42)
+             | ((static_cast<uint64_t>(c.y) & mask) << 21)
+             |  (static_cast<uint64_t>(c.z) & mask);
+    }
+
+    // Visit every item whose centre may lie within the largest radius of
+    // the box [lo, hi]: by cell when the box is small, else all items.
+    template<typename Fn>
+    void ForEachCandidate(Vector3 lo, Vector3 hi, Fn&& fn) const {
+        const Vector3 pad = { m_maxRadius, m_maxRadius, m_maxRadius };
+        const Cell a = CellOf(Vector3Subtract(lo, pad));
+        const Cell b = CellOf(Vector3Add(hi, pad));
+        const double cells = (double(b.x) - a.x + 1.0) * (double(b.y) - a.y + 1.0) * (double(b.z) - a.z + 1.0);
+        if (cells > static_cast<double>(m_cells.size())) {
+            for (const Item& item : m_items) fn(item);
+            return;
+        }
+        for (int32_t x = a.x; x <= b.x; ++x)
+        for (int32_t y = a.y; y <= b.y; ++y)
+        for (int32_t z = a.z; z <= b.z; ++z) {
+            const auto it = m_cells.find(Key({ x, y, z }));
+            if (it == m_cells.end()) continue;
+            for (const uint32_t i : it->second) fn(m_items[i]);
+        }
+    }
+
+    // Bring entity e's entry in line with the registry.
+    void Refile(const Registry& reg, EntityId e) {
+        if (!reg.HasComponent<ColliderSphereComponent>(e)) { Remove(e); return; }
+        const bool hasWorld = reg.HasComponent<WorldTransformComponent>(e);
+        if (!hasWorld && !reg.HasComponent<TransformComponent>(e)) { Remove(e); return; }
+
+        Vector3 pos;
+        if (hasWorld) {
+            const Matrix& m = reg.GetComponent<WorldTransformComponent>(e).matrix;
+            pos = { m.m12, m.m13, m.m14 };
+        } else {
+            pos = reg.GetComponent<TransformComponent>(e).position;
+        }
+        const float    radius = reg.GetComponent<ColliderSphereComponent>(e).radius;
+        const uint64_t cell   = Key(CellOf(pos));
+        m_maxRadius = std::max(m_maxRadius, radius);
+
+        const uint32_t idx = EntityIndex(e);
+        if (idx >= m_itemOf.size()) m_itemOf.resize(idx + 1u, NONE);
+        if (m_itemOf[idx] != NONE && m_items[m_itemOf[idx]].id != e) Remove(m_items[m_itemOf[idx]].id);
+
+        if (m_itemOf[idx] == NONE) {
+            m_itemOf[idx] = static_cast<uint32_t>(m_items.size());
+            m_items.push_back({ e, pos, radius, cell, 0u });
+            Link(m_itemOf[idx]);
+            return;
+        }
+        Item& item  = m_items[m_itemOf[idx]];
+        item.pos    = pos;
+        item.radius = radius;
+        if (item.cell == cell) return;
+        Unlink(m_itemOf[idx]);
+        item.cell = cell;
+        Link(m_itemOf[idx]);
+    }
+
+    void Remove(EntityId e) {
+        const uint32_t idx = EntityIndex(e);
+        if (idx >= m_itemOf.size() || m_itemOf[idx] == NONE || m_items[m_itemOf[idx]].id != e) return;
+        const uint32_t i = m_itemOf[idx];
+        Unlink(i);
+        m_itemOf[idx] = NONE;
+
+        const uint32_t last = static_cast<uint32_t>(m_items.size()) - 1u;
+        if (i != last) {
+            m_items[i] = m_items[last];
+            m_itemOf[EntityIndex(m_items[i].id)] = i;
+            m_cells[m_items[i].cell][m_items[i].slot] = i;
+        }
+        m_items.pop_back();
+        if (m_items.empty()) m_maxRadius = 0.0f;
+    }
+
+    void Link(uint32_t i) {
+        std::vector<uint32_t>& cell = m_cells[m_items[i].cell];
+        m_items[i].slot = static_cast<uint32_t>(cell.size());
+        cell.push_back(i);
+    }
+
+    void Unlink(uint32_t i) {
+        const auto it = m_cells.find(m_items[i].cell);
+        std::vector<uint32_t>& cell = it->second;
+        const uint32_t moved = cell.back();
+        cell[m_items[i].slot] = moved;
+        m_items[moved].slot   = m_items[i].slot;
+        cell.pop_back();
+        if (cell.empty()) m_cells.erase(it);
+    }
+
+    float                                            m_cellSize;
+    float                                            m_invCell;
+    float                                            m_maxRadius = 0.0f;   // largest radius indexed
+    SignalConnection                                 m_onDestroy;
+    uint32_t                                         m_since     = 0;
+    std::vector<Item>                                m_items;              // dense
+    std::vector<uint32_t>                            m_itemOf;             // entity index → item
+    std::unordered_map<uint64_t, std::vector<uint32_t>> m_cells;           // cell key → items
+};
+
+} // namespace Hotones::ECS
@@ -1,9 +1,62 @@
 #pragma once
 
+#include <ECS/ComponentType.hpp>
+
+#include <typeinfo>
+
 namespace Hotones::ECS {
 
 class Registry;
 
+// ---------------------------------------------------------------------------
+// SystemAccess — the component types a System touches in Update().
+//
+// The SystemScheduler runs two systems at the same time only when neither
+// writes a type the other reads or writes. A system that does anything the
+// masks cannot describe — creating entities, adding components, calling into
+// Lua, touching engine globals — must stay Exclusive(), which is the default.
+//
+//   void DeclareAccess(SystemAccess& access) const override {
+//       access.Reads<VelocityComponent>().Writes<TransformComponent>();
+//   }
+// ---------------------------------------------------------------------------
+
+class SystemAccess {
+public:
+    template<typename... Ts>
+    SystemAccess& Reads() {
+        (m_reads.set(ComponentType<Ts>()), ...);
+        m_exclusive = false;
+        return *this;
+    }
+
+    template<typename... Ts>
+    SystemAccess& Writes() {
+        (m_writes.set(ComponentType<Ts>()), ...);
+        m_exclusive = false;
+        return *this;
+    }
+
+    // The system must run alone, on the thread calling the scheduler.
+    SystemAccess& Exclusive() noexcept { m_exclusive = true; return *this; }
+
+    [[nodiscard]] bool IsExclusive() const noexcept { return m_exclusive; }
+    [[nodiscard]] const ComponentMask& ReadMask()  const noexcept { return m_reads; }
+    [[nodiscard]] const ComponentMask& WriteMask() const noexcept { return m_writes; }
+
+    // True if the two systems must not run concurrently.
+    [[nodiscard]] bool ConflictsWith(const SystemAccess& other) const noexcept {
+        if (m_exclusive || other.m_exclusive) return true;
+        return (m_writes & (other.m_reads | other.m_writes)).any()
+            || (other.m_writes & m_reads).any();
+    }
+
+private:
+    ComponentMask m_reads;
+    ComponentMask m_writes;
+    bool          m_exclusive = true;
+};
+
 // ---------------------------------------------------------------------------
 // System — base class for all ECS systems.
 //
@@ -15,6 +68,9 @@ class Registry;
 // -----
 //   class MovementSystem : public System {
 //   public:
+//       void DeclareAccess(SystemAccess& access) const override {
+//           access.Reads<VelocityComponent>().Writes<TransformComponent>();
+//       }
 //       void Update(Registry& reg, float dt) override {
 //           reg.View<TransformComponent, VelocityComponent>(
 //               [dt](EntityId, TransformComponent& t, VelocityComponent& v) {
@@ -26,8 +82,9 @@ class Registry;
 //
 // Recommended ownership
 // ---------------------
-//   Store systems in a SystemManager or std::vector<std::unique_ptr<System>>
-//   and call Update on each one per frame from the scene's Update() method.
+//   Register systems with a SystemScheduler (ECS/SystemScheduler.hpp) and
+//   call its Update once per frame from the scene's Update() method. Systems
+//   that declare their access run concurrently when they do not conflict.
 // ---------------------------------------------------------------------------
 
 class System {
@@ -44,6 +101,13 @@ public:
     // Optional: called on scene Unload to release GPU / physics resources.
     virtual void Shutdown(Registry& /*reg*/) {}
 
+    // Optional: the component types Update() reads and writes. Systems that
+    // do not override this are exclusive and never run alongside another.
+    virtual void DeclareAccess(SystemAccess& access) const { access.Exclusive(); }
+
+    // Display name used in scheduler timings.
+    [[nodiscard]] virtual const char* Name() const { return typeid(*this).name(); }
+
     // Systems can be individually paused without removing them.
     void  SetEnabled(bool enabled) noexcept { m_enabled = enabled; }
     [[nodiscard]] bool IsEnabled() const noexcept { return m_enabled; }
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <ECS/System.hpp>
+#include <ECS/Registry.hpp>
+#include <ECS/JobSystem.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// SystemScheduler — runs a list of Systems once per frame, in parallel where
+// their declared component access allows it.
+//
+// Each Update():
+//   1. Asks every enabled system for its SystemAccess.
+//   2. Splits the list at Exclusive systems. Those run alone on the calling
+//      thread with full access to the registry, exactly as before.
+//   3. Between two exclusive systems, builds a dependency DAG: system B
+//      depends on an earlier system A when their access conflicts. Systems
+//      whose dependencies are done are handed to the JobSystem, so
+//      independent systems run concurrently on the work-stealing pool.
+//
+// Registration order is the tie-break: conflicting systems always run in
+// the order they were added, so results do not depend on thread timing.
+//
+// Structural changes in the parallel phase
+// ----------------------------------------
+//   The registry is held in iteration while a parallel batch runs and each
+//   system gets its own CommandBuffer (see Registry::CommandScope).
+//   DestroyEntity / RemoveComponent / Commands().Add<T> are recorded there
+//   and played back after the batch, in registration order.
+//
+//   Update() ends with Registry::Sync(), so lifecycle signals (OnConstruct /
+//   OnUpdate / OnDestroy) are delivered once per frame.
+//
+// Usage
+// -----
+//   SystemScheduler systems;
+//   systems.Add<LifetimeSystem>();
+//   systems.Add<MyPhysicsSync>();
+//   systems.Init(reg);
+//   ...
+//   systems.Update(reg, dt);                  // every frame
+//   for (auto& t : systems.Timings()) ...     // per-system ms of last frame
+// ---------------------------------------------------------------------------
+
+class SystemScheduler {
+public:
+    // Wall-clock cost of one system in the last Update().
+    struct Timing {
+        const System* system;
+        const char*   name;
+        double        milliseconds;
+        unsigned      thread;   // JobSystem::ThreadIndex() it ran on
+    };
+
+    explicit SystemScheduler(JobSystem& jobs = JobSystem::Get()) : m_jobs(&jobs) {}
+
+    SystemScheduler(const SystemScheduler&)            = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    // Construct and register a system. Systems run in registration order
+    // whenever their access conflicts.
+    template<typename S, typename... Args>
+    S& Add(Args&&... args) {
+        auto system = std::make_unique<S>(std::forward<Args>(args)...);
+        S& ref = *system;
+        m_systems.push_back(std::move(system));
+        return ref;
+    }
+
+    void Init(Registry& reg) {
+        for (auto& s : m_systems) s->Init(reg);
+    }
+
+    // Shut down in reverse registration order.
+    void Shutdown(Registry& reg) {
+        for (size_t i = m_systems.size(); i-- > 0;) m_systems[i]->Shutdown(reg);
+    }
+
+    // Run every enabled system once. Must not be called from inside a view.
+    void Update(Registry& reg, float dt) {
+        assert(!reg.IsIterating() && "SystemScheduler::Update — called from inside a View / Each");
+        const auto frameStart = Clock::now();
+
+        m_frame.clear();
+        m_access.clear();
+        m_timings.clear();
+        for (auto& s : m_systems) {
+            if (!s->IsEnabled()) continue;
+            m_frame.push_back(s.get());
+            SystemAccess access;
+            s->DeclareAccess(access);
+            m_access.push_back(access);
+        }
+        m_timings.resize(m_frame.size());
+
+        size_t begin = 0;
+        while (begin < m_frame.size()) {
+            size_t end = begin;
+            while (end < m_frame.size() && !m_access[end].IsExclusive()) ++end;
+            if (end == begin) {
+                RunSystem(reg, dt, begin);   // exclusive
+                ++end;
+            } else {
+                RunBatch(reg, dt, begin, end);
+            }
+            begin = end;
+        }
+        reg.Sync();
+
+        m_frameMs = Milliseconds(frameStart, Clock::now());
+    }
+
+    // Per-system timings of the last Update(), in registration order.
+    [[nodiscard]] const std::vector<Timing>& Timings() const noexcept { return m_timings; }
+
+    // Wall-clock cost of the last Update(), including playback of deferred
+    // commands and delivery of lifecycle signals.
+    [[nodiscard]] double FrameMilliseconds() const noexcept { return m_frameMs; }
+
+    // With parallel off every system runs on the calling thread, in
+    // registration order, with the same deferral of structural changes.
+    // Useful when debugging a suspected data race.
+    void SetParallel(bool parallel) noexcept { m_parallel = parallel; }
+    [[nodiscard]] bool IsParallel() const noexcept { return m_parallel; }
+
+    [[nodiscard]] size_t Size() const noexcept { return m_systems.size(); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static double Milliseconds(Clock::time_point a, Clock::time_point b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    }
+
+    void RunSystem(Registry& reg, float dt, size_t i) {
+        const auto start = Clock::now();
+        m_frame[i]->Update(reg, dt);
+        m_timings[i] = { m_frame[i], m_frame[i]->Name(),
+                         Milliseconds(start, Clock::now()), m_jobs->ThreadIndex() };
+    }
+
+    // Run systems [begin, end) — none exclusive — as a DAG on the job pool.
+    void RunBatch(Registry& reg, float dt, size_t begin, size_t end) {
+        const size_t n = end - begin;
+        if (m_buffers.size() < n) m_buffers.resize(n);
+
+        if (n == 1 || !m_parallel) {
+            // Nothing to overlap: same semantics, no job overhead.
+            {
+                Registry::IterationScope hold(reg);
+                for (size_t k = 0; k < n; ++k) {
+                    Registry::CommandScope scope(reg, m_buffers[k]);
+                    RunSystem(reg, dt, begin + k);
+                }
+            }
+            FlushBuffers(reg, n);
+            return;
+        }
+
+        m_successors.resize(n);
+        for (auto& s : m_successors) s.clear();
+        m_roots.clear();
+        auto pending = std::make_unique<std::atomic<uint32_t>[]>(n);
+        for (size_t b = 0; b < n; ++b) {
+            uint32_t deps = 0;
+            for (size_t a = 0; a < b; ++a) {
+                if (!m_access[begin + a].ConflictsWith(m_access[begin + b])) continue;
+                m_successors[a].push_back(static_cast<uint32_t>(b));
+                ++deps;
+            }
+            pending[b].store(deps, std::memory_order_relaxed);
+            if (deps == 0) m_roots.push_back(static_cast<uint32_t>(b));
+        }
+
+        JobSystem::Counter done;
+        // Submit node k; when it finishes, release the successors whose
+        // last dependency it was. A node's successors are submitted before
+        // its own job is counted as done, so `done` cannot drain early.
+        auto launch = [&](auto& self, size_t k) -> void {
+            m_jobs->Submit([&, k] {
+                {
+                    Registry::CommandScope scope(reg, m_buffers[k]);
+                    RunSystem(reg, dt, begin + k);
+                }
+                for (const uint32_t next : m_successors[k])
+                    if (pending[next].fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+                        self(self, next);
+            }, done);
+        };
+
+        {
+            Registry::IterationScope hold(reg);
+            // Roots are collected up front: once the first one is running,
+            // pending[] also reaches zero for nodes it releases itself.
+            for (const uint32_t k : m_roots) launch(launch, k);
+            m_jobs->Wait(done);
+        }
+
+        FlushBuffers(reg, n);
+    }
+
+    // Play back the batch's deferred changes in registration order.
+    void FlushBuffers(Registry& reg, size_t n) {
+        for (size_t k = 0; k < n; ++k)
+            if (!m_buffers[k].Empty()) m_buffers[k].Flush(reg);
+    }
+
+    JobSystem*                           m_jobs;
+    std::vector<std::unique_ptr<System>> m_systems;
+    bool                                 m_parallel = true;
+
+    // Per-frame scratch, kept to reuse capacity.
+    std::vector<System*>               m_frame;      // enabled systems this frame
+    std::vector<SystemAccess>          m_access;     // parallel to m_frame
+    std::vector<std::vector<uint32_t>> m_successors; // DAG edges within a batch
+    std::vector<uint32_t>              m_roots;      // batch nodes with no dependency
+    std::vector<CommandBuffer>         m_buffers;    // one per batch slot
+
+    std::vector<Timing> m_timings;
+    double              m_frameMs = 0.0;
+};
+
+} // namespace Hotones::ECS
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <ECS/Registry.hpp>
+#include <ECS/Components.hpp>
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// TagIndex — reverse lookup TagComponent::name → entities.
+//
+//   TagIndex tags(reg);
+//   for (EntityId door : tags.Find("Door")) ...
+//   EntityId spawn = tags.FindFirst("SpawnPoint");
+//
+// Kept in sync with the registry two ways:
+//   - tags added or written (AddComponent, mutable GetComponent / View)
+//     are picked up from change tracking at the start of every Find, so a
+//     tag set a moment ago is already found;
+//   - an OnDestroy<TagComponent> observer unlinks removed tags at sync
+//     points, and Find drops entries whose entity has died since.
+// Each lookup is O(1) plus the size of the result.
+//
+// Entities with an empty tag are not indexed. The index must not outlive
+// its registry.
+// ---------------------------------------------------------------------------
+
+class TagIndex {
+public:
+    explicit TagIndex(Registry& reg) : m_reg(&reg) {
+        reg.TrackChanges<TagComponent>();
+        m_onDestroy = reg.OnDestroy<TagComponent>(
+            [this](Registry&, std::span<const EntityId> ids, std::span<TagComponent>) {
+                for (const EntityId id : ids) {
+                    const uint32_t idx = EntityIndex(id);
+                    if (idx < m_slots.size() && m_slots[idx].owner == id) Unlink(idx);
+                }
+            });
+    }
+    ~TagIndex() { m_reg->Disconnect(m_onDestroy); }
+
+    TagIndex(const TagIndex&)            = delete;
+    TagIndex& operator=(const TagIndex&) = delete;
+
+    // Live entities tagged `tag`, in no particular order. The span is valid
+    // until the next call on this index.
+    [[nodiscard]] std::span<const EntityId> Find(StringId tag) {
+        Refresh();
+        const auto it = m_buckets.find(tag);
+        if (it == m_buckets.end()) return {};
+        std::vector<EntityId>& bucket = it->second;
+        for (size_t i = 0; i < bucket.size();) {
+            const EntityId e = bucket[i];
+            if (m_reg->IsAlive(e) && m_reg->HasComponent<TagComponent>(e)) { ++i; continue; }
+            const bool last = bucket.size() == 1;
+            Unlink(EntityIndex(e));   // swaps the last entry into i
+            if (last) return {};      // bucket erased
+        }
+        return bucket;
+    }
+
+    // Any live entity tagged `tag`, or INVALID_ENTITY.
+    [[nodiscard]] EntityId FindFirst(StringId tag) {
+        const std::span<const EntityId> found = Find(tag);
+        return found.empty() ? INVALID_ENTITY : found.front();
+    }
+
+private:
+    struct Slot {
+        EntityId owner = INVALID_ENTITY;   // entity indexed in this slot
+        StringId tag;
+        uint32_t pos   = 0;                // position in m_buckets[tag]
+    };
+
+    // Index everything tagged or re-tagged since the previous refresh.
+    void Refresh() {
+        const uint32_t since = m_since;
+        m_since = m_reg->AdvanceTick();
+        m_reg->ViewChanged<TagComponent>(since, [this](EntityId e, const TagComponent& t) { Link(e, t.name); });
+    }
+
+    void Link(EntityId e, StringId tag) {
+        const uint32_t idx = EntityIndex(e);
+        if (idx >= m_slots.size()) m_slots.resize(idx + 1u);
+        Slot& slot = m_slots[idx];
+        if (slot.owner == e && slot.tag == tag) return;
+        if (slot.owner != INVALID_ENTITY) Unlink(idx);
+        if (tag.Empty()) return;
+        std::vector<EntityId>& bucket = m_buckets[tag];
+        slot = { e, tag, static_cast<uint32_t>(bucket.size()) };
+        bucket.push_back(e);
+    }
+
+    // Swap-remove slot idx's entity from its bucket.
+    void Unlink(uint32_t idx) {
+        Slot& slot = m_slots[idx];
+        const auto it = m_buckets.find(slot.tag);
+        std::vector<EntityId>& bucket = it->second;
+        const EntityId last = bucket.back();
+        bucket[slot.pos] = last;
+        m_slots[EntityIndex(last)].pos = slot.pos;
+        bucket.pop_back();
+        if (bucket.empty()) m_buckets.erase(it);
+        slot = Slot{};
+    }
+
+    Registry*                                           m_reg;
+    SignalConnection                                    m_onDestroy;
+    uint32_t                                            m_since = 0;
+    std::unordered_map<StringId, std::vector<EntityId>> m_buckets;
+    std::vector<Slot>                                   m_slots;   // by entity index
+};
+
+} // namespace Hotones::ECS
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <ECS/System.hpp>
+#include <ECS/Registry.hpp>
+#include <ECS/Components.hpp>
+#include <ECS/Hierarchy.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace Hotones::ECS {
+
+// ---------------------------------------------------------------------------
+// TransformPropagationSystem — keeps WorldTransformComponent::matrix equal to
+// the entity's local TransformComponent composed with its parent's world
+// matrix (see ECS/Hierarchy.hpp for building the hierarchy).
+//
+// Every tracked entity sits in one dense array sorted by depth (roots first,
+// then their children, and so on), so a single forward pass sees each parent
+// before its children. An entry is rebuilt only when
+//   - its local transform differs from the one its matrix was built from,
+//   - its parent was rebuilt earlier in the same pass, or
+//   - its parent is not the one the matrix was composed with (reparented,
+//     or the parent was destroyed).
+// Everything else is one compare per entity; an unchanged hat on an
+// unchanged avatar costs no matrix work at all.
+//
+// The depth order is rebuilt only when the set of tracked entities or a
+// parent link changed. An entity without a TransformComponent uses the
+// identity as its local transform; one whose parent is dead or untracked is
+// treated as a root.
+//
+// Rebuilt matrices are stamped for Registry change tracking, so a render
+// proxy sync can ViewChanged<WorldTransformComponent> instead of scanning.
+//
+// Register it after the systems that move things (MovementSystem, physics
+// sync) so the matrices are current when the scene draws. While registered
+// it also keeps sibling lists exact across plain DestroyEntity calls (see
+// UnlinkOnDestroy in ECS/Hierarchy.hpp).
+// ---------------------------------------------------------------------------
+
+class TransformPropagationSystem : public System {
+public:
+    void DeclareAccess(SystemAccess& access) const override {
+        access.Reads<TransformComponent, ParentComponent>().Writes<WorldTransformComponent>();
+    }
+
+    void Update(Registry& reg, float /*dt*/) override {
+        if (!reg.PoolPtr<WorldTransformComponent>()) return;
+        if (m_order.size() != reg.PoolPtr<WorldTransformComponent>()->Size()) Rebuild(reg);
+        if (Propagate(reg, false)) return;
+        // An entry went stale mid-pass (destroyed, untracked or reparented
+        // behind our back): rebuild the order and finish the job, also
+        // re-propagating what the aborted pass already rebuilt.
+        Rebuild(reg);
+        Propagate(reg, true);
+    }
+
+    void Init(Registry& reg) override {
+        m_onDestroy = UnlinkOnDestroy(reg);
+    }
+
+    void Shutdown(Registry& reg) override {
+        reg.Disconnect(m_onDestroy);
+        m_onDestroy = {};
+        m_order.clear();
+        m_parents.clear();
+        m_parentSlots.clear();
+    }
+
+    // Number of world matrices rebuilt in the last Update().
+    [[nodiscard]] size_t RebuiltCount() const noexcept { return m_rebuilt; }
+
+    [[nodiscard]] const char* Name() const override { return "TransformPropagationSystem"; }
+
+private:
+    static constexpr uint32_t NO_SLOT  = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t UNKNOWN  = NO_SLOT;
+    static constexpr uint32_t VISITING = NO_SLOT - 1u;
+
+    // Raw parent link of entity idx, INVALID_ENTITY when it has none.
+    [[nodiscard]] static EntityId LinkOf(const ComponentPool<ParentComponent>* links, uint32_t idx) {
+        return links && links->Has(idx) ? links->Get(idx).parent : INVALID_ENTITY;
+    }
+
+    // One pass over m_order. Returns false, leaving the rest of the array
+    // untouched, when an entry no longer matches the registry. With carry
+    // set, entries flagged `changed` also count as dirty.
+    bool Propagate(Registry& reg, bool carry) {
+        auto*       world = reg.PoolPtr<WorldTransformComponent>();
+        const auto* local = reg.PoolPtr<TransformComponent>();
+        const auto* links = reg.PoolPtr<ParentComponent>();
+
+        const uint32_t tick = reg.Tick();
+        m_dirty.assign(m_order.size(), 0u);
+        m_rebuilt = 0;
+        for (size_t i = 0; i < m_order.size(); ++i) {
+            const EntityId e   = m_order[i];
+            const uint32_t idx = EntityIndex(e);
+            if (!reg.IsAlive(e) || !world->Has(idx) || LinkOf(links, idx) != m_parents[i])
+                return false;
+
+            WorldTransformComponent&  w = world->Get(idx);
+            const TransformComponent  t = local && local->Has(idx) ? local->Get(idx) : TransformComponent{};
+            const uint32_t            p = m_parentSlots[i];
+            const EntityId       parent = (p == NO_SLOT) ? INVALID_ENTITY : m_order[p];
+
+            const bool dirty = (carry && w.changed) || parent != w.parent
+                            || (p != NO_SLOT && m_dirty[p])
+                            || std::memcmp(&t, &w.local, sizeof(TransformComponent)) != 0;
+            m_dirty[i] = dirty;
+            w.changed  = dirty;
+            if (!dirty) continue;
+
+            world->Touch(idx, tick);
+            w.local  = t;
+            w.parent = parent;
+            const Matrix m = t.ToMatrix();
+            w.matrix = (p == NO_SLOT)
+                ? m
+                : MatrixMultiply(m, world->Get(EntityIndex(parent)).matrix);
+            ++m_rebuilt;
+        }
+        return true;
+    }
+
+    // Sort every tracked entity by depth: depths are resolved by walking
+    // parent chains (memoised per entity), then a counting sort keeps the
+    // pool order within a level.
+    void Rebuild(Registry& reg) {
+        const auto* world = reg.PoolPtr<WorldTransformComponent>();
+        const auto* links = reg.PoolPtr<ParentComponent>();
+        const size_t n    = world->Size();
+
+        m_ids.clear();
+        m_ids.reserve(n);
+        reg.Each<const WorldTransformComponent>([this](EntityId e, const WorldTransformComponent&) { m_ids.push_back(e); });
+
+        // Dense index of entity idx's tracked parent, or NO_SLOT for a root.
+        auto parentOf = [&](uint32_t idx) -> uint32_t {
+            const EntityId parent = LinkOf(links, idx);
+            if (!reg.IsAlive(parent) || !world->Has(EntityIndex(parent))) return NO_SLOT;
+            return world->DenseIndex(EntityIndex(parent));
+        };
+
+        m_depth.assign(n, UNKNOWN);
+        uint32_t maxDepth = 0;
+        for (uint32_t d = 0; d < n; ++d) {
+            uint32_t cur = d;
+            while (m_depth[cur] == UNKNOWN) {
+                m_depth[cur] = VISITING;
+                m_stack.push_back(cur);
+                const uint32_t up = parentOf(EntityIndex(m_ids[cur]));
+                if (up == NO_SLOT || m_depth[up] == VISITING) break;  // root, or a cycle cut here
+                cur = up;
+            }
+            uint32_t depth = (m_depth[cur] < VISITING) ? m_depth[cur] + 1u : 0u;
+            while (!m_stack.empty()) {
+                m_depth[m_stack.back()] = depth++;
+                m_stack.pop_back();
+            }
+            if (depth > 0 && depth - 1u > maxDepth) maxDepth = depth - 1u;
+        }
+
+        m_levelStart.assign(maxDepth + 2u, 0u);
+        for (uint32_t d = 0; d < n; ++d) ++m_levelStart[m_depth[d] + 1u];
+        for (size_t l = 1; l < m_levelStart.size(); ++l) m_levelStart[l] += m_levelStart[l - 1];
+
+        m_order.resize(n);
+        m_slotOf.resize(n);
+        for (uint32_t d = 0; d < n; ++d) {
+            const uint32_t slot = m_levelStart[m_depth[d]]++;
+            m_order[slot] = m_ids[d];
+            m_slotOf[d]   = slot;
+        }
+
+        m_parents.resize(n);
+        m_parentSlots.resize(n);
+        for (uint32_t slot = 0; slot < n; ++slot) {
+            const uint32_t idx = EntityIndex(m_order[slot]);
+            const uint32_t up  = parentOf(idx);
+            m_parents[slot]     = LinkOf(links, idx);
+            // A cycle cut leaves a "parent" that is not above us; treat as root.
+            m_parentSlots[slot] = (up != NO_SLOT && m_slotOf[up] < slot) ? m_slotOf[up] : NO_SLOT;
+        }
+    }
+
+    std::vector<EntityId> m_order;       // tracked entities, sorted by depth
+    std::vector<EntityId> m_parents;     // raw parent link per slot, to spot reparenting
+    std::vector<uint32_t> m_parentSlots; // slot of the parent, NO_SLOT for roots
+    std::vector<uint8_t>  m_dirty;       // per slot: rebuilt in the current pass
+    size_t                m_rebuilt = 0;
+    SignalConnection      m_onDestroy;
+
+    // Rebuild scratch, kept to reuse capacity.
+    std::vector<EntityId> m_ids;         // WorldTransform pool in dense order
+    std::vector<uint32_t> m_depth;       // per dense index
+    std::vector<uint32_t> m_slotOf;      // dense index → slot in m_order
+    std::vector<uint32_t> m_levelStart;
+    std::vector<uint32_t> m_stack;
+};
+
+} // namespace Hotones::ECS
@@ -26,6 +26,13 @@ public:
     // `hitPos` (position at impact), `hitNormal` (surface normal), and `t` (0..1 param along segment).
     bool SweepSphere(const Vector3 &start, const Vector3 &end, float radius, Vector3 &hitPos, Vector3 &hitNormal, float &t);
 
+    // The collision BVH is built in the background after construction; until
+    // it is ready the two queries above report no collision.
+    bool IsPhysicsReady() const;
+    // Block until the BVH is built; timeoutSeconds < 0 waits indefinitely.
+    // Returns IsPhysicsReady().
+    bool WaitForPhysics(float timeoutSeconds = -1.f) const;
+
     // Apply a custom shader to all materials in this model (e.g. lit shader).
     void SetShader(Shader shader);
 
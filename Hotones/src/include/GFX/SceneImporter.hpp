@@ -115,6 +115,15 @@ struct ImportedScene {
     // ── Light queries ──────────────────────────────────────────────────────
     const std::vector<SceneLight>& GetLights() const { return lights; }
 
+    // ── Physics ────────────────────────────────────────────────────────────
+
+    // Collision BVHs of registered meshes are built in the background.
+    // True once every one of them is ready.
+    bool IsPhysicsReady() const;
+    // Block until they are; timeoutSeconds < 0 waits indefinitely (the
+    // whole wait shares one budget). Returns IsPhysicsReady().
+    bool WaitForPhysics(float timeoutSeconds = -1.f) const;
+
     // ── Lifecycle ──────────────────────────────────────────────────────────
     void Unload();
 };
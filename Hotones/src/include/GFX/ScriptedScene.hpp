@@ -3,12 +3,14 @@
 #include <GFX/Scene.hpp>
 #include <GFX/Player.hpp>
 #include <ECS/Registry.hpp>
+#include <ECS/SystemScheduler.hpp>
 #include <memory>
 #include <raylib.h>
 
 // Forward declarations
 namespace Hotones          { class CollidableModel; }
 namespace Hotones::Net     { class NetworkManager;  }
+namespace Hotones::ECS     { class SpatialIndexSystem; }
 namespace Hotones::Scripting { class CupLoader;     }
 
 namespace Hotones {
@@ -39,6 +41,9 @@ public:
 
     Player* GetPlayer() { return &m_player; }
 
+    /// The scene's ECS world (read-only; debug overlay statistics).
+    const ECS::Registry& GetRegistry() const { return m_registry; }
+
     void SetNetworkManager(Net::NetworkManager* nm);
 
 private:
@@ -48,6 +53,9 @@ private:
     std::shared_ptr<CollidableModel> m_world;
     Net::NetworkManager*             m_netMgr   = nullptr;
     ECS::Registry                    m_registry;   ///< ECS world for this scene
+    ECS::SystemScheduler             m_systems;    ///< script-free ECS systems, run each Update
+    ECS::SpatialIndexSystem*         m_spatial  = nullptr;   ///< owned by m_systems; backs ecs.queryRadius
+    bool                             m_loaded   = false;     ///< between Init and Unload
 
     void DrawFallbackGround() const;
 };
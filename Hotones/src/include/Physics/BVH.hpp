@@ -0,0 +1,145 @@
+#pragma once
+
+// ── Hotones::Physics — triangle BVH ──────────────────────────────────────────
+//
+// Mid-phase acceleration structure behind every static-mesh query in
+// PhysicsSystem.cpp. Kept in its own translation unit (no raylib library
+// calls, only its math types) so tools such as bench/physics_bench can build
+// and query a BVH without the engine.
+//
+//   BVH bvh;
+//   bvh.Build(std::move(tris), options);       // options: PhysicsSystem.hpp
+//   float t = 1000.f; Vector3 n;
+//   bvh.Raycast(origin, dir, t, n);            // t shrinks to the nearest hit
+//
+// Every query takes an optional BVHQueryStats* that counts visited nodes and
+// tested triangles, for profiling builders against each other.
+//
+// Build may fan the top of the tree out over a JobSystem: each split of at
+// least options.parallelMinTris triangles builds its right half as a job
+// while the calling thread builds the left, and the halves are spliced
+// back into one node array. The tree is identical to a serial build.
+
+#include <Physics/PhysicsSystem.hpp>
+#include <raylib.h>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define HOTONES_PHYSICS_SSE 1
+    #include <immintrin.h>
+#endif
+
+namespace Hotones::ECS { class JobSystem; }
+
+namespace Hotones { namespace Physics {
+
+struct Tri {
+    Vector3 a, b, c;
+    Vector3 centroid;
+};
+
+struct BVHNode {
+    // AABB enclosing all triangles in this subtree
+    Vector3 bmin, bmax;
+    // If leaf: [triStart, triStart+triCount)  in the reordered triangle array
+    // If internal: left child = index+1, right child = rightChild
+    int triStart = 0, triCount = 0;
+    int rightChild = -1; // -1 → leaf
+};
+
+// Work counters filled by the BVH queries (accumulated, never reset).
+struct BVHQueryStats {
+    uint64_t nodes = 0;   // nodes whose AABB was tested
+    uint64_t tris  = 0;   // triangle tests run
+};
+
+struct BVH {
+    // Deepest level the builders create (nodes below it become leaves,
+    // whatever their size); sizes the traversal stacks.
+    static constexpr int MAX_DEPTH = 64;
+
+    std::vector<BVHNode> nodes;
+    std::vector<Tri>     tris;   // reordered
+
+    // Build from a flat triangle list; with `jobs`, large subtrees are built
+    // in parallel (the calling thread takes part).
+    void Build(std::vector<Tri>&& inTris, const BVHBuildOptions& options = {},
+               ECS::JobSystem* jobs = nullptr);
+
+    // SAH cost of the built tree relative to testing every triangle at the
+    // root (traversal + intersection costs from the build options); lower
+    // is better. Comparable between builders for the same mesh.
+    [[nodiscard]] float SahCost(const BVHBuildOptions& options = {}) const;
+
+    // Nearest hit of the ray ro + rd * t, t ∈ (0, bestT). On a hit bestT and
+    // bestN (face normal facing the ray) are updated. Traversal is ordered
+    // near-to-far and culls subtrees beyond bestT, so a tight initial bestT
+    // (the caller's max distance) makes the query cheaper.
+    void Raycast(Vector3 ro, Vector3 rd, float& bestT, Vector3& bestN,
+                 BVHQueryStats* stats = nullptr) const;
+
+    // Four rays traversed as one packet, each lane with the contract of
+    // Raycast; a lane with bestT < 0 is idle. Pays off for coherent rays
+    // (nearby origins, directions in one octant), which visit nearly the
+    // same nodes. Stats count the packet's work, not each ray's.
+    void Raycast4(const Vector3 ro[4], const Vector3 rd[4], float bestT[4], Vector3 bestN[4],
+                  BVHQueryStats* stats = nullptr) const;
+
+    // Earliest contact of a sphere swept start → end, t ∈ [0, bestT] as a
+    // fraction of the segment. On a hit bestT and bestN are updated.
+    void SweepSphere(Vector3 start, Vector3 end, float radius, float& bestT, Vector3& bestN,
+                     BVHQueryStats* stats = nullptr) const;
+
+    // Accumulate into outPush the push-out of every triangle the sphere
+    // overlaps; didPush is set when there was at least one.
+    void ResolveSphere(Vector3 center, float radius, Vector3& outPush, bool& didPush,
+                       BVHQueryStats* stats = nullptr) const;
+};
+
+// Exact per-triangle tests behind the queries, shared by the BVH layouts,
+// and the box test shared with the world-level tree in PhysicsSystem.cpp.
+namespace detail {
+
+// Ray prepared for slab tests: origin and per-axis inverse direction.
+// Zero components get a huge finite inverse instead of infinity so a ray
+// lying in a slab plane never computes 0 * inf.
+struct SlabRay {
+    Vector3 o, inv;
+};
+
+inline SlabRay MakeSlabRay(Vector3 o, Vector3 d) {
+    auto inv = [](float v) { return std::fabs(v) > 1e-20f ? 1.f / v : (v < 0.f ? -1e30f : 1e30f); };
+    return { o, { inv(d.x), inv(d.y), inv(d.z) } };
+}
+
+// Entry distance of the ray into `node`'s box grown by `pad`, clipped to
+// [0, tMax]; FLT_MAX when it misses.
+// std::min / std::max rather than fminf / fmaxf: the latter honour NaN
+// operands and are not inlined without -ffast-math.
+inline float SlabEnter(const SlabRay& r, const BVHNode& node, float pad, float tMax) {
+    float tx1 = (node.bmin.x - pad - r.o.x) * r.inv.x, tx2 = (node.bmax.x + pad - r.o.x) * r.inv.x;
+    float ty1 = (node.bmin.y - pad - r.o.y) * r.inv.y, ty2 = (node.bmax.y + pad - r.o.y) * r.inv.y;
+    float tz1 = (node.bmin.z - pad - r.o.z) * r.inv.z, tz2 = (node.bmax.z + pad - r.o.z) * r.inv.z;
+    float tEnter = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::max(std::min(tz1, tz2), 0.f));
+    float tExit  = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::min(std::max(tz1, tz2), tMax));
+    return tEnter <= tExit ? tEnter : FLT_MAX;
+}
+
+// Möller-Trumbore. t > 0 of the hit or FLT_MAX; outNormal faces the ray.
+float RayTriangleMT(Vector3 ro, Vector3 rd, Vector3 ta, Vector3 tb, Vector3 tc,
+                    Vector3& outNormal);
+
+// Sphere swept start → end; t ∈ [0, 1] of first contact or FLT_MAX.
+float SweepSphereTriangle(Vector3 start, Vector3 end, float radius,
+                          Vector3 ta, Vector3 tb, Vector3 tc, Vector3& outNormal);
+
+// Adds the push-out of an overlapping sphere to outPush; false if apart.
+bool SpherePushOut(Vector3 center, float radius, const Tri& tri, Vector3& outPush);
+
+} // namespace detail
+
+}} // namespace Hotones::Physics
@@ -0,0 +1,71 @@
+#pragma once
+
+// ── Hotones::Physics — 4-wide triangle BVH ───────────────────────────────────
+//
+// Query layout of a built BVH (BVHLayout::Wide4): the binary tree collapsed
+// so every node holds up to four children, their boxes stored lane by lane
+// (SoA) so one SSE slab test covers all four. Leaf triangles are packed four
+// to a TriPacket4, vertices again lane by lane: ray leaves run Möller-Trumbore
+// on a whole packet at once, sweeps and penetration test the four triangle
+// boxes at once and run the exact scalar kernels only on lanes that pass.
+//
+//   BVH bvh;
+//   bvh.Build(std::move(tris), options);
+//   BVH4 wide;
+//   wide.Collapse(std::move(bvh));              // takes the triangles
+//   wide.Raycast(origin, dir, t, n);            // same queries as BVH
+//
+// Without SSE the kernels fall back to per-lane scalar loops.
+
+#include <Physics/BVH.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Hotones { namespace Physics {
+
+struct alignas(64) BVH4Node {
+    // Child boxes, one lane per child.
+    float bminX[4], bminY[4], bminZ[4];
+    float bmaxX[4], bmaxY[4], bmaxZ[4];
+    // Per child: internal → node index and count 0; leaf → first packet and
+    // packet count; unused lane → -1.
+    int32_t child[4];
+    int32_t count[4];
+};
+
+struct alignas(16) TriPacket4 {
+    float   a[3][4];    // vertices, [axis][lane]
+    float   b[3][4];
+    float   c[3][4];
+    int32_t tri[4];     // index into BVH4::tris; -1 pads a short packet
+};
+
+struct BVH4 {
+    // A node pushes at most four children, one of which is popped next, and
+    // the collapsed tree is no deeper than the binary one.
+    static constexpr int STACK_SIZE = 3 * BVH::MAX_DEPTH + 1;
+
+    std::vector<BVH4Node>   nodes;     // nodes[0] is the root
+    std::vector<TriPacket4> packets;
+    std::vector<Tri>        tris;      // in the binary tree's order
+
+    // Replace the contents with `binary` collapsed to four-wide nodes.
+    // A subtree of at most four triangles becomes one packet.
+    void Collapse(BVH&& binary);
+
+    [[nodiscard]] bool Empty() const { return nodes.empty(); }
+
+    // Same contracts as the BVH queries. Stats count child boxes and
+    // triangle lanes tested.
+    void Raycast(Vector3 ro, Vector3 rd, float& bestT, Vector3& bestN,
+                 BVHQueryStats* stats = nullptr) const;
+    // One ray at a time: the wide node tests already fill the SIMD lanes.
+    void Raycast4(const Vector3 ro[4], const Vector3 rd[4], float bestT[4], Vector3 bestN[4],
+                  BVHQueryStats* stats = nullptr) const;
+    void SweepSphere(Vector3 start, Vector3 end, float radius, float& bestT, Vector3& bestN,
+                     BVHQueryStats* stats = nullptr) const;
+    void ResolveSphere(Vector3 center, float radius, Vector3& outPush, bool& didPush,
+                       BVHQueryStats* stats = nullptr) const;
+};
+
+}} // namespace Hotones::Physics
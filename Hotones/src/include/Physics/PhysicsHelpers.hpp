@@ -17,9 +17,16 @@
 //   auto sweep = Hotones::Physics::SweepSphere(meshHandle,
 //                                              start, end, 0.5f);
 //   if (sweep) { ... }
+//
+//   auto any = Hotones::Physics::RaycastWorld(origin, dir, 500.f);
+//   if (any) { ... }     // any.handle is the mesh that was hit
+//
+//   auto hits = Hotones::Physics::RaycastBatch(meshHandle, rays);
+//   // hits[i] answers rays[i]
 
 #include <Physics/PhysicsSystem.hpp>
 #include <raylib.h>
+#include <vector>
 
 namespace Hotones::Physics {
 
@@ -29,6 +36,7 @@ struct RaycastResult {
     Vector3 pos    = { 0, 0, 0 };
     Vector3 normal = { 0, 1, 0 };
     float   t      = 0.f;
+    int     handle = -1;   ///< Mesh that was hit, -1 on a miss.
 
     explicit operator bool() const { return hit; }
 };
@@ -40,6 +48,17 @@ struct SweepResult {
     Vector3 normal = { 0, 1, 0 };
     /// Fraction [0,1] along the sweep segment where contact first occurs.
     float   t      = 0.f;
+    int     handle = -1;   ///< Mesh that was hit, -1 on a miss.
+
+    explicit operator bool() const { return hit; }
+};
+
+/// Result of a penetration resolve.  Evaluates to `true` when the sphere was pushed.
+struct ResolveResult {
+    bool    hit    = false;
+    /// Sphere centre after the push (the input centre when nothing overlapped).
+    Vector3 center = { 0, 0, 0 };
+    int     handle = -1;   ///< Mesh that pushed furthest, -1 when none did.
 
     explicit operator bool() const { return hit; }
 };
@@ -54,6 +73,7 @@ inline RaycastResult Raycast(int handle,
     RaycastResult res;
     res.hit = RaycastAgainstStatic(handle, origin, dir, maxDist,
                                    res.pos, res.normal, res.t);
+    if (res.hit) res.handle = handle;
     return res;
 }
 
@@ -66,7 +86,58 @@ inline SweepResult SweepSphere(int handle,
     SweepResult res;
     res.hit = SweepSphereAgainstStatic(handle, start, end, radius,
                                        res.pos, res.normal, res.t);
+    if (res.hit) res.handle = handle;
     return res;
 }
 
+/// Cast a ray against every static mesh; `handle` reports the one hit.
+inline RaycastResult RaycastWorld(const Vector3& origin,
+                                  const Vector3& dir,
+                                  float maxDist = 1000.f)
+{
+    RaycastResult res;
+    res.hit = RaycastWorld(origin, dir, maxDist,
+                           res.pos, res.normal, res.t, res.handle);
+    return res;
+}
+
+/// Sweep a sphere against every static mesh; `handle` reports the one hit.
+inline SweepResult SweepSphereWorld(const Vector3& start,
+                                    const Vector3& end,
+                                    float radius)
+{
+    SweepResult res;
+    res.hit = SweepSphereWorld(start, end, radius,
+                               res.pos, res.normal, res.t, res.handle);
+    return res;
+}
+
+/// Push a sphere out of every static mesh it overlaps.
+inline ResolveResult ResolveSphereWorld(const Vector3& center, float radius)
+{
+    ResolveResult res;
+    res.center = center;
+    res.hit    = ResolveSphereWorld(res.center, radius, res.handle);
+    return res;
+}
+
+/// Cast a batch of rays against one mesh; result i answers rays[i].
+inline std::vector<BatchHit> RaycastBatch(int handle,
+                                          std::span<const BatchRay> rays,
+                                          const RaycastBatchOptions& options = {})
+{
+    std::vector<BatchHit> hits(rays.size());
+    RaycastBatch(handle, rays, std::span<BatchHit>(hits), options);
+    return hits;
+}
+
+/// Cast a batch of rays against every static mesh; result i answers rays[i].
+inline std::vector<BatchHit> RaycastBatchWorld(std::span<const BatchRay> rays,
+                                               const RaycastBatchOptions& options = {})
+{
+    std::vector<BatchHit> hits(rays.size());
+    RaycastBatchWorld(rays, std::span<BatchHit>(hits), options);
+    return hits;
+}
+
 } // namespace Hotones::Physics
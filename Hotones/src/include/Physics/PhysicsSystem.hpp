@@ -1,17 +1,70 @@
 #pragma once
 #include <raylib.h>
+#include <cstddef>
+#include <span>
+
+namespace Hotones::ECS { class JobSystem; }
 
 namespace Hotones { namespace Physics {
 
 // Initialize the physics subsystem. Returns true on success.
-bool InitPhysics();
+// buildWorkers threads build static-mesh BVHs in the background
+// (0: one per hardware thread, leaving one for the caller).
+bool InitPhysics(unsigned buildWorkers = 0);
+// Cancels builds that have not started, waits for running ones.
 void ShutdownPhysics();
 
+// How static-mesh BVHs are built.
+enum class BVHBuilder {
+    Mean,       // split the longest axis at the centroid mean — fast to build
+    BinnedSAH,  // binned surface-area heuristic — tighter trees, faster queries
+};
+
+// How a built BVH is laid out for queries.
+enum class BVHLayout {
+    Binary,     // two children per node, one triangle test at a time
+    Wide4,      // collapsed to four children per node with SIMD box tests
+                // and triangles in packets of four (see Physics/BVH4.hpp)
+};
+
+struct BVHBuildOptions {
+    BVHBuilder builder       = BVHBuilder::BinnedSAH;
+    BVHLayout  layout        = BVHLayout::Binary;
+    int        bins          = 16;    // SAH candidate planes per axis + 1, clamped to [4, 32]
+    int        maxLeafSize   = 4;     // a node with more triangles is always split
+    float      traversalCost = 1.0f;  // SAH cost of visiting a node ...
+    float      triangleCost  = 1.0f;  // ... relative to testing one triangle
+    int        parallelMinTris = 16384; // on a worker pool, subtrees this large
+                                        // are built as separate jobs
+};
+
+// Options used for meshes registered from now on (already-built BVHs keep
+// theirs). Thread-safe.
+void SetBVHBuildOptions(const BVHBuildOptions& options);
+BVHBuildOptions GetBVHBuildOptions();
+
 // Register a static (non-moving) collision mesh built from a raylib `Model`.
 // Returns a positive handle id on success, or -1 if registration failed / not available.
+// The BVH is built on the physics workers; until it is ready, queries
+// against the handle report no hit (see IsStaticMeshReady / WaitForStaticMesh).
 int RegisterStaticMeshFromModel(const Model& model, const Vector3& position);
 void UnregisterStaticMesh(int handle);
 
+// True once the BVH of `handle` has been built.
+bool IsStaticMeshReady(int handle);
+
+// Block until the BVH of `handle` is built (or the handle is unregistered).
+// timeoutSeconds < 0 waits indefinitely. Returns IsStaticMeshReady(handle).
+bool WaitForStaticMesh(int handle, float timeoutSeconds = -1.f);
+
+// Meshes registered but not built yet.
+int PendingStaticMeshBuilds();
+
+// Block until every queued build has finished — "physics ready" after a
+// level load. Without a timeout the calling thread helps build.
+// Returns true when nothing is pending.
+bool WaitForStaticMeshBuilds(float timeoutSeconds = -1.f);
+
 // Continuous sphere sweep against a registered static mesh.
 // start/end are sphere center positions. Returns true if hit; t ∈ [0,1].
 bool SweepSphereAgainstStatic(int handle, const Vector3& start, const Vector3& end,
@@ -31,4 +84,57 @@ bool RaycastAgainstStatic(int handle, const Vector3& origin, const Vector3& dir,
                            float maxDist,
                            Vector3& hitPos, Vector3& hitNormal, float& t);
 
+// ─── World queries ────────────────────────────────────────────────────────────
+//
+// The queries above against every built static mesh at once, through a
+// top-level tree over the meshes' bounds that is kept current as meshes are
+// registered and unregistered. hitHandle is the mesh that was hit.
+
+bool RaycastWorld(const Vector3& origin, const Vector3& dir, float maxDist,
+                  Vector3& hitPos, Vector3& hitNormal, float& t, int& hitHandle);
+
+bool SweepSphereWorld(const Vector3& start, const Vector3& end, float radius,
+                      Vector3& hitPos, Vector3& hitNormal, float& t, int& hitHandle);
+
+// Pushes `center` out of every mesh it overlaps, each mesh's push computed
+// from the original center; hitHandle is the mesh that pushed furthest.
+bool ResolveSphereWorld(Vector3& center, float radius, int& hitHandle);
+
+// ─── Batched rays ─────────────────────────────────────────────────────────────
+
+// One ray of a batch, as the arguments of RaycastAgainstStatic.
+struct BatchRay {
+    Vector3 origin  = { 0, 0, 0 };
+    Vector3 dir     = { 0, 0, 1 };
+    float   maxDist = 1000.f;
+};
+
+// Result of one batch ray; handle is the mesh that was hit, -1 on a miss.
+struct BatchHit {
+    bool    hit    = false;
+    Vector3 pos    = { 0, 0, 0 };
+    Vector3 normal = { 0, 1, 0 };
+    float   t      = 0.f;
+    int     handle = -1;
+};
+
+struct RaycastBatchOptions {
+    bool            sortRays   = true;     // trace in coherence order (octant, then origin)
+    bool            packets    = true;     // four same-octant rays share one traversal
+    ECS::JobSystem* jobs       = nullptr;  // fan chunks out over this pool (null: caller only)
+    size_t          raysPerJob = 256;      // chunk size when fanning out
+};
+
+// Cast rays[i] into hits[i] for every i (up to the shorter span) against
+// one registered static mesh, with the results RaycastAgainstStatic would
+// give. The registry lock is taken once for the whole batch, not per ray.
+// Returns the number of hits.
+int RaycastBatch(int handle, std::span<const BatchRay> rays, std::span<BatchHit> hits,
+                 const RaycastBatchOptions& options = {});
+
+// The same against every built static mesh through the world tree; each hit
+// reports the nearest mesh's handle.
+int RaycastBatchWorld(std::span<const BatchRay> rays, std::span<BatchHit> hits,
+                      const RaycastBatchOptions& options = {});
+
 }} // namespace Hotones::Physics
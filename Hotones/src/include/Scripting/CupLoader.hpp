@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <atomic>
+#include <utility>
+#include <vector>
 
 struct lua_State;
 
@@ -14,6 +17,17 @@ namespace Hotones::Scripting {
 class CupPackage;
 class CppLoader;
 
+/// Memory hints from the optional `Init.ECS` table, applied to the ECS
+/// registry of the scene that runs the pack (LuaLoader::reserveECS).
+///
+///   Init.ECS = { ArenaKB = 4096, Entities = 20000,
+///                Reserve = { Transform = 20000, Velocity = 5000 } }
+struct ECSMemoryHints {
+    size_t arenaBytes = 0;   ///< first arena chunk (ArenaKB × 1024); 0 = default
+    size_t entities   = 0;   ///< entity table capacity
+    std::vector<std::pair<std::string, size_t>> reserve;   ///< component name → pool capacity
+};
+
 class CupLoader {
 public:
     CupLoader();
@@ -59,6 +73,9 @@ public:
     // Empty string if none was declared or loadPak has not been called.
     const std::string& mainScenePath() const { return m_mainScene; }
 
+    // Hints read from Init.ECS (all zero / empty when the pack has none).
+    const ECSMemoryHints& ecsMemoryHints() const { return m_ecsHints; }
+
     // Reload the previously-loaded package by re-executing its init.lua.
     // Returns true on success.
     bool reload();
@@ -92,6 +109,7 @@ private:
     std::string            m_mainScene;
     std::string            m_initPath;    ///< absolute path to last loaded init.lua
     std::string            m_packageRoot; ///< package root directory
+    ECSMemoryHints         m_ecsHints;    ///< Init.ECS, if declared
     int                    m_classRef;    ///< LUA_REGISTRY key of MainClass table; LUA_NOREF = none
     std::string            m_lastLuaError; ///< Last Lua error message
     Net::NetworkManager*   m_netMgr = nullptr;      ///< optional network manager for network.* API
@@ -2,8 +2,9 @@
 
 struct lua_State;
 
-namespace Hotones::ECS { class Registry; }
+namespace Hotones::ECS { class Registry; class SpatialIndexSystem; }
 namespace Hotones       { class Player;   }
+namespace Hotones::Scripting { struct ECSMemoryHints; }
 
 namespace Hotones::Scripting::LuaLoader {
 
@@ -19,6 +20,17 @@ void setECSRegistry(ECS::Registry* reg);
 /// engine player controller.  Mirrors the LocalPlayer library's pointer.
 void setECSLocalPlayer(Player* player);
 
+/// Set the spatial index ecs.queryRadius() searches (normally the scene's
+/// SpatialIndexSystem). Pass nullptr when the owning scheduler shuts down.
+void setECSSpatialIndex(ECS::SpatialIndexSystem* index);
+
+// ── Memory hints ─────────────────────────────────────────────────────────────
+/// Apply a pack's Init.ECS hints (CupLoader::ecsMemoryHints) to a registry
+/// before the scene spawns anything: sizes the arena's first chunk (only
+/// while the registry is empty), the entity table, and the pools named in
+/// Init.ECS.Reserve (the component names ecs.query accepts).
+void reserveECS(ECS::Registry& reg, const ECSMemoryHints& hints);
+
 // ── Registration ─────────────────────────────────────────────────────────────
 /// Register the `ecs` global table into the given Lua state.
 ///
@@ -28,6 +40,11 @@ void setECSLocalPlayer(Player* player);
 ///   ecs.destroy(id)                               -- destroy + strip all components
 ///   ecs.isAlive(id)                 → bool
 ///
+/// Prefabs
+/// -------
+///   ecs.prefab(desc)                → handle      -- desc: entity id or component table
+///   ecs.spawn(handle, n [, pos])    → { ids }     -- n instances; pos = flat xyz list
+///
 /// Transform  (auto-created on first setPos / setScale / setVelocity)
 /// ---------
 ///   ecs.setPos(id, x, y, z)
@@ -36,10 +53,29 @@ void setECSLocalPlayer(Player* player);
 ///   ecs.setVelocity(id, vx, vy, vz)
 ///   ecs.getVelocity(id)             → vx, vy, vz
 ///
+/// Batched access  (one call for many entities)
+/// --------------
+///   ecs.getPositions(ids [, xs, ys, zs]) → xs, ys, zs
+///   ecs.setPositions(ids, xs, ys, zs)
+///   ecs.query({ "Transform", "Health", ... } [, out]) → out, n
+///                                   -- out.ids, out.x, out.hp, ... columns
+///
+/// Hierarchy
+/// ---------
+///   ecs.setParent(id, parent)                     -- nil parent detaches
+///   ecs.getParent(id)               → parent (or nil)
+///   ecs.getWorldPos(id)             → x, y, z
+///
 /// Tag
 /// ---
 ///   ecs.setTag(id, name)
 ///   ecs.getTag(id)                  → string (or "")
+///   ecs.findByTag(name)             → { ids }
+///
+/// Spatial queries  (entities with a position and a ColliderSphere)
+/// ---------------
+///   ecs.setCollider(id, radius)
+///   ecs.queryRadius(x, y, z, r [, out]) → out, count
 ///
 /// Health
 /// ------
@@ -54,6 +90,12 @@ void setECSLocalPlayer(Player* player);
 ///   ecs.setLifetime(id, seconds)    -- add/replace LifetimeComponent
 ///   ecs.getLifetime(id)             → remaining  (0 if absent)
 ///
+/// Deferred mutation
+/// -----------------
+///   When called while the registry is iterating (from inside a View / Each),
+///   destroy / remove and component-adding setters are routed through the
+///   registry's CommandBuffer and applied when the iteration ends.
+///
 /// Player controller  (NOT added by default — must be called explicitly)
 /// -----------------
 ///   ecs.addPlayer(id)               -- link entity to the engine Player
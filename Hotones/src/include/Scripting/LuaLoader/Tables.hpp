@@ -0,0 +1,48 @@
+#pragma once
+
+#include <lua.hpp>
+
+// Result-table helpers shared by the LuaLoader libraries whose bindings
+// fill caller-supplied arrays (ecs.query*, physics.raycastBatch, ...).
+
+namespace Hotones::Scripting::LuaLoader {
+
+// Push the table to fill with an n-entry result array: the caller's table
+// at arg when there is one (entries past n are cleared, so it can be reused
+// every frame without garbage), a new one otherwise.
+inline void pushOutArray(lua_State* L, int arg, lua_Integer n)
+{
+    if (!lua_istable(L, arg)) { lua_createtable(L, static_cast<int>(n), 0); return; }
+    lua_pushvalue(L, arg);
+    for (lua_Integer i = static_cast<lua_Integer>(lua_rawlen(L, -1)); i > n; --i) {
+        lua_pushnil(L);
+        lua_rawseti(L, -2, i);
+    }
+}
+
+// Same for the array in field key of the table at (absolute) index t; the
+// field is created if it is not a table yet.
+inline void pushOutField(lua_State* L, int t, const char* key, lua_Integer n)
+{
+    lua_getfield(L, t, key);
+    if (lua_istable(L, -1)) {
+        pushOutArray(L, -1, n);
+        lua_remove(L, -2);
+        return;
+    }
+    lua_pop(L, 1);
+    lua_createtable(L, static_cast<int>(n), 0);
+    lua_pushvalue(L, -1);
+    lua_setfield(L, t, key);
+}
+
+// Entry i of the array at (absolute) index t, as a number.
+inline float numberAt(lua_State* L, int t, lua_Integer i)
+{
+    lua_rawgeti(L, t, i);
+    const auto v = static_cast<float>(lua_tonumber(L, -1));
+    lua_pop(L, 1);
+    return v;
+}
+
+} // namespace Hotones::Scripting::LuaLoader
@@ -4,6 +4,7 @@
 #include <string>
 #include <memory>
 #include <mutex>
+#include <StringId.hpp>
 
 namespace Ho_tones {
 
@@ -25,22 +26,26 @@ public:
     // Load a sound file and associate it under a logical group name. Multiple
     // files can be loaded under the same `name` to form variants.
     // Returns true on success.
-    bool LoadSoundFile(const std::string& name, const std::string& filePath);
+    //
+    // Names are interned StringIds: strings convert implicitly, and callers
+    // playing the same name often (or holding it in a component, like
+    // AudioEmitterComponent::soundKey) skip the string hash entirely.
+    bool LoadSoundFile(Hotones::StringId name, const std::string& filePath);
 
     // Play a previously loaded sound by name. Plays the first loaded variant.
-    bool PlayLoaded(const std::string& name, float gain = 1.0f);
+    bool PlayLoaded(Hotones::StringId name, float gain = 1.0f);
 
     // Play a random variant from the loaded group for `name`.
-    bool PlayRandom(const std::string& name, float gain = 1.0f);
+    bool PlayRandom(Hotones::StringId name, float gain = 1.0f);
 
     // Play the next variant in the loaded group for `name` in a round-robin
     // fashion. This ensures each file in the category is played in turn.
-    bool PlaySequential(const std::string& name, float gain = 1.0f);
+    bool PlaySequential(Hotones::StringId name, float gain = 1.0f);
 
     // Async/overlapping version of PlaySequential: will load a fresh copy of
     // the selected variant and play it immediately so multiple footsteps can
     // overlap. Returns true if playback started.
-    bool PlaySequentialAsync(const std::string& name, float gain = 1.0f);
+    bool PlaySequentialAsync(Hotones::StringId name, float gain = 1.0f);
     // Play raw PCM interleaved 16-bit signed samples.
     // `data` is interleaved PCM (frames * channels).
     // `sampleRate` is samples per second of the data.
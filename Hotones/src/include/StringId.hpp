@@ -0,0 +1,120 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Hotones {
+
+// ---------------------------------------------------------------------------
+// StringId — an interned string, stored as a 32-bit id.
+//
+// Constructing a StringId from text registers the text in a process-wide
+// table (once) and keeps only the id, so components holding names stay
+// trivially copyable and compare / hash as integers:
+//
+//   TagComponent tag{ "Bullet" };               // interned here
+//   if (tag.name == StringId("Bullet")) ...     // integer compare
+//   lua_pushstring(L, tag.name.CStr());         // text lookup
+//
+// The id is the FNV-1a hash of the text. The table checks for collisions:
+// a second string hashing to a taken id gets the next free one, so two
+// different strings never share an id. Ids are therefore stable within a
+// process but not across runs — persist the text (see ECS::Snapshot), not
+// the id.
+//
+// The empty string is id 0, the default. Interned strings live until the
+// process exits; intern names, not per-frame text.
+//
+// Thread-safe: interning takes an exclusive lock, lookups a shared one.
+// ---------------------------------------------------------------------------
+
+class StringId {
+public:
+    constexpr StringId() noexcept = default;
+
+    // Intern text (implicit, so components keep their aggregate syntax).
+    StringId(std::string_view text) : m_value(Intern(text)) {}
+    StringId(const char* text)        : StringId(std::string_view(text)) {}
+    StringId(const std::string& text) : StringId(std::string_view(text)) {}
+
+    // Id of text if it was interned before, the empty id otherwise. Never
+    // adds to the table: use it for lookups driven by external input.
+    [[nodiscard]] static StringId Find(std::string_view text) {
+        if (text.empty()) return {};
+        Table& table = GetTable();
+        std::shared_lock lock(table.mutex);
+        for (uint32_t id = Hash(text);; id = Next(id)) {
+            const auto it = table.strings.find(id);
+            if (it == table.strings.end()) return {};
+            if (it->second == text) return FromValue(id);
+        }
+    }
+
+    [[nodiscard]] static constexpr StringId FromValue(uint32_t value) noexcept {
+        StringId id;
+        id.m_value = value;
+        return id;
+    }
+
+    [[nodiscard]] constexpr uint32_t Value() const noexcept { return m_value; }
+    [[nodiscard]] constexpr bool     Empty() const noexcept { return m_value == 0; }
+
+    // The interned text ("" for the empty id or an id never interned). The
+    // pointer stays valid for the life of the process.
+    [[nodiscard]] const char* CStr() const {
+        if (m_value == 0) return "";
+        Table& table = GetTable();
+        std::shared_lock lock(table.mutex);
+        const auto it = table.strings.find(m_value);
+        return it == table.strings.end() ? "" : it->second.c_str();
+    }
+    [[nodiscard]] std::string_view View() const { return CStr(); }
+
+    friend constexpr bool operator==(StringId a, StringId b) noexcept { return a.m_value == b.m_value; }
+    friend constexpr auto operator<=>(StringId a, StringId b) noexcept { return a.m_value <=> b.m_value; }
+
+private:
+    struct Table {
+        std::shared_mutex                         mutex;
+        std::unordered_map<uint32_t, std::string> strings;   // nodes are stable
+    };
+
+    static Table& GetTable() {
+        static Table s_table;
+        return s_table;
+    }
+
+    [[nodiscard]] static constexpr uint32_t Hash(std::string_view text) noexcept {
+        uint32_t h = 2166136261u;
+        for (const char c : text) { h ^= static_cast<uint8_t>(c); h *= 16777619u; }
+        return h == 0 ? 1u : h;   // 0 is reserved for the empty string
+    }
+    [[nodiscard]] static constexpr uint32_t Next(uint32_t id) noexcept { return id == ~0u ? 1u : id + 1u; }
+
+    static uint32_t Intern(std::string_view text) {
+        if (text.empty()) return 0;
+        if (const StringId known = Find(text); !known.Empty()) return known.m_value;
+
+        Table& table = GetTable();
+        std::unique_lock lock(table.mutex);
+        for (uint32_t id = Hash(text);; id = Next(id)) {
+            const auto [it, inserted] = table.strings.try_emplace(id, text);
+            if (inserted || it->second == text) return id;   // new, or raced in by another thread
+        }
+    }
+
+    uint32_t m_value = 0;
+};
+
+} // namespace Hotones
+
+template<>
+struct std::hash<Hotones::StringId> {
+    size_t operator()(Hotones::StringId id) const noexcept { return id.Value(); }
+};
@@ -502,6 +502,41 @@ int main(int argc, char** argv)
                         ImGui::EndTabItem();
                     }
 
+                    // ── ECS ──────────────────────────────────────────────────
+                    if (ImGui::BeginTabItem("ECS")) {
+                        if (auto* ss = dynamic_cast<Hotones::ScriptedScene*>(sceneMgr.GetCurrent())) {
+                            const Hotones::ECS::Registry&    reg   = ss->GetRegistry();
+                            const Hotones::ECS::MemoryArena& arena = reg.Arena();
+                            auto kib = [](size_t bytes) { return static_cast<double>(bytes) / 1024.0; };
+
+                            ImGui::Text("Entities: %zu", reg.EntityCount());
+                            ImGui::SeparatorText("Pool arena (this scene)");
+                            ImGui::Text("In use:   %10.1f KiB", kib(arena.BytesInUse()));
+                            ImGui::Text("Peak:     %10.1f KiB", kib(arena.PeakBytes()));
+                            ImGui::Text("Reserved: %10.1f KiB", kib(arena.ReservedBytes()));
+                            ImGui::SetItemTooltip("Heap memory held by the arena, including free lists and outgrown buffers");
+
+                            if (ImGui::CollapsingHeader("Pools")) {
+                                if (ImGui::BeginTable("##ecspools", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+                                    ImGui::TableSetupColumn("Component");
+                                    ImGui::TableSetupColumn("Count");
+                                    ImGui::TableSetupColumn("KiB");
+                                    ImGui::TableHeadersRow();
+                                    for (const auto& pool : reg.MemoryStats()) {
+                                        ImGui::TableNextRow();
+                                        ImGui::TableNextColumn(); ImGui::TextUnformatted(pool.typeName);
+                                        ImGui::TableNextColumn(); ImGui::Text("%zu", pool.count);
+                                        ImGui::TableNextColumn(); ImGui::Text("%.1f", kib(pool.Total()));
+                                    }
+                                    ImGui::EndTable();
+                                }
+                            }
+                        } else {
+                            ImGui::TextDisabled("The current scene has no ECS world.");
+                        }
+                        ImGui::EndTabItem();
+                    }
+
                     // ── Network ──────────────────────────────────────────────
                     if (ImGui::BeginTabItem("Network")) {
                         auto mode = netMgr.GetMode();